@@ -25,6 +25,8 @@
 #ifndef CRYPTO3_ACCUMULATORS_BLOCK_HPP
 #define CRYPTO3_ACCUMULATORS_BLOCK_HPP
 
+#include <stdexcept>
+
 #include <boost/container/static_vector.hpp>
 
 #include <boost/parameter/value_type.hpp>
@@ -69,6 +71,7 @@ namespace nil {
 
                     constexpr static const std::size_t value_bits = sizeof(typename block_type::value_type) * CHAR_BIT;
                     constexpr static const std::size_t block_values = block_bits / value_bits;
+                    constexpr static const std::size_t block_octets = block_bits / octet_bits;
 
                     typedef ::nil::crypto3::detail::injector<endian_type, endian_type, value_bits, block_values>
                         injector_type;
@@ -78,7 +81,7 @@ namespace nil {
 
                     template<typename Args>
                     block_impl(const Args &args) :
-                        total_seen(0), filled(false), mode(args[boost::accumulators::sample]) {
+                        mode(args[boost::accumulators::sample]), filled(false), begun(false), total_seen(0) {
                     }
 
                     template<typename ArgumentPack>
@@ -88,21 +91,87 @@ namespace nil {
                     }
 
                     inline result_type result(boost::accumulators::dont_care) const {
-                        using namespace ::nil::crypto3::detail;
+                        result_type res;
+                        res.reserve(dgst.size() + block_octets);
+                        res.assign(dgst.begin(), dgst.end());
 
-                        result_type res = dgst;
+                        end_message(res,
+                                    std::integral_constant<bool, block::detail::is_stream_mode<mode_type>::value>());
 
-                        block_type processed_block = mode.end_message(cache, total_seen);
+                        finish_message(res,
+                                       std::integral_constant<bool, block::detail::is_aead_mode<mode_type>::value>());
 
-                        res = ::nil::crypto3::resize<block_bits>(res, res.size() + block_values);
+                        return res;
+                    }
 
-                        pack<endian_type, endian_type, value_bits, octet_bits>(
-                            processed_block.begin(), processed_block.end(), res.end() - block_values);
+                    /*!
+                     * @brief Preallocates the output for a message of the given length, so that
+                     * processed blocks are appended without reallocating the accumulated result.
+                     */
+                    inline void reserve(std::size_t bits) {
+                        dgst.reserve(((bits + block_bits - 1) / block_bits + 1) * block_octets);
+                    }
 
-                        return res;
+                    /*!
+                     * @brief Moves the blocks processed so far to out and drops them from the accumulated
+                     * result. The last block of the message is held back until result() since the mode
+                     * finalizes it, so result() afterwards yields only what has not been flushed yet.
+                     * Not available for authenticated decryptions, whose output is only released by
+                     * result() once the tag has been checked.
+                     */
+                    template<typename OutputIterator>
+                    inline OutputIterator flush(OutputIterator out) {
+                        BOOST_STATIC_ASSERT_MSG(!block::detail::is_authenticated_decryption<mode_type>::value,
+                                                "unverified plaintext can't be flushed before the tag is checked");
+
+                        out = std::move(dgst.begin(), dgst.end(), out);
+                        dgst.clear();
+                        return out;
                     }
 
                 protected:
+                    inline void append_block(result_type &res, const block_type &block) const {
+                        using namespace ::nil::crypto3::detail;
+
+                        res.resize(res.size() + block_octets);
+
+                        pack<endian_type, endian_type, value_bits, octet_bits>(block.begin(), block.end(),
+                                                                               res.end() - block_octets);
+                    }
+
+                    inline void end_message(result_type &res, std::false_type) const {
+                        append_block(res, mode.end_message(cache, total_seen));
+                    }
+
+                    /*!
+                     * @brief Stream modes emit exactly as many octets as they were given, so the keystream
+                     * surplus of the last block is cut off, and an empty message produces no keystream at
+                     * all.
+                     */
+                    inline void end_message(result_type &res, std::true_type) const {
+                        if (total_seen == 0) {
+                            return;
+                        }
+
+                        append_block(res, mode.end_message(cache, total_seen));
+                        res.resize(res.size() - (block_bits - total_seen % block_bits) % block_bits / octet_bits);
+                    }
+
+                    inline void finish_message(result_type &, std::false_type) const {
+                    }
+
+                    /*!
+                     * @brief Lets authenticated modes append the tag on encryption or check the received
+                     * one on decryption.
+                     * @throws std::invalid_argument if decryption failed to authenticate. The output is
+                     * wiped before.
+                     */
+                    inline void finish_message(result_type &res, std::true_type) const {
+                        if (!mode.finish_message(cache, total_seen, res)) {
+                            throw std::invalid_argument("message failed to authenticate");
+                        }
+                    }
+
                     inline void resolve_type(const block_type &value, std::size_t bits) {
                         process(value, bits == 0 ? block_bits : bits);
                     }
@@ -115,16 +184,17 @@ namespace nil {
                         using namespace ::nil::crypto3::detail;
 
                         block_type processed_block;
-                        if (dgst.empty()) {
+                        if (!begun) {
                             processed_block = mode.begin_message(cache, total_seen);
+                            begun = true;
                         } else {
                             processed_block = mode.process_block(cache, total_seen);
                         }
 
-                        dgst = ::nil::crypto3::resize<block_bits>(dgst, dgst.size() + block_values);
+                        dgst.resize(dgst.size() + block_octets);
 
                         pack<endian_type, endian_type, value_bits, octet_bits>(
-                            processed_block.begin(), processed_block.end(), dgst.end() - block_values);
+                            processed_block.begin(), processed_block.end(), dgst.end() - block_octets);
 
                         filled = false;
                     }
@@ -182,7 +252,7 @@ namespace nil {
                             } else {
                                 // The incoming value is not a full block
                                 std::move(value.begin(),
-                                          value.begin() + value_seen / word_bits + (value_seen % word_bits ? 1 : 0),
+                                          value.begin() + value_seen / value_bits + (value_seen % value_bits ? 1 : 0),
                                           cache.begin());
                             }
                         }
@@ -235,6 +305,7 @@ namespace nil {
                     mode_type mode;
 
                     bool filled;
+                    bool begun;
                     std::size_t total_seen;
                     block_type cache;
                     result_type dgst;
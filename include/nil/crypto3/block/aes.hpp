@@ -35,6 +35,12 @@ namespace nil {
              */
             template<std::size_t KeyBits>
             using aes = rijndael<KeyBits, 128>;
+
+            /*!
+             * @brief Encryption-only AES, for modes which never run the inverse cipher.
+             */
+            template<std::size_t KeyBits>
+            using aes_encryption = rijndael_encryption<KeyBits, 128>;
         }    // namespace block
     }        // namespace crypto3
 }    // namespace nil
@@ -73,9 +73,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(first, last, std::move(out),
-                                 CipherAccumulator(DecryptionMode(
-                                     BlockCipher(block::cipher_key<BlockCipher>(key_first, key_last).key))));
+            return DecrypterImpl(first, last, std::move(out), block::cipher_key<BlockCipher>(key_first, key_last).key);
         }
 
         /*!
@@ -107,9 +105,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(
-                first, last, std::move(out),
-                CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(first, last, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -141,9 +137,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(
-                first, last, std::move(out),
-                CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(first, last, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -174,7 +168,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(first, last, std::move(out), CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(first, last, std::move(out), key.key);
         }
 
         /*!
@@ -289,15 +283,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(InputIterator first, InputIterator last, KeyInputIterator key_first, KeyInputIterator key_last) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(first, last,
-                                 CipherAccumulator(DecryptionMode(
-                                     BlockCipher(block::cipher_key<BlockCipher>(key_first, key_last).key))));
+            return DecrypterImpl(first, last, block::cipher_key<BlockCipher>(key_first, key_last).key);
         }
 
         /*!
@@ -321,14 +310,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(InputIterator first, InputIterator last, const KeySinglePassRange &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(
-                first, last, CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(first, last, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -352,14 +337,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(InputIterator first, InputIterator last, std::initializer_list<KeySinglePassRange> key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(
-                first, last, CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(first, last, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -382,13 +363,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(InputIterator first, InputIterator last, const block::cipher_key<BlockCipher> &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(first, last, CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(first, last, key.key);
         }
 
         /*!
@@ -418,9 +396,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(
-                rng, std::move(out),
-                CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(rng, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -449,9 +425,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(
-                rng, std::move(out),
-                CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(rng, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -480,7 +454,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(rng, std::move(out), CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(rng, std::move(out), key.key);
         }
 
         /*!
@@ -508,7 +482,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamDecrypterImpl, OutputIterator> DecrypterImpl;
 
-            return DecrypterImpl(rng, std::move(out), CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(rng, std::move(out), key.key);
         }
 
         /*!
@@ -536,9 +510,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(
-                rng, std::move(out),
-                CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(rng, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -565,9 +537,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(
-                rng, std::move(out),
-                CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(rng, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -594,7 +564,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(rng, std::move(out), CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(rng, std::move(out), key.key);
         }
 
         /*!
@@ -621,7 +591,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(rng, std::move(out), CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(rng, std::move(out), key.key);
         }
 
         /*!
@@ -646,14 +616,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(const SinglePassRange &r, const KeySinglePassRange &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(
-                r, CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(r, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -677,14 +643,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(std::initializer_list<T> r, std::initializer_list<K> key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(
-                r, CipherAccumulator(DecryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return DecrypterImpl(r, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -706,13 +668,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(const SinglePassRange &r, const block::cipher_key<BlockCipher> &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(r, CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(r, key.key);
         }
 
         /*!
@@ -733,13 +692,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             decrypt(std::initializer_list<T> r, const block::cipher_key<BlockCipher> &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::decryption_policy<BlockCipher>>::type DecryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamDecrypterImpl;
             typedef block::detail::range_cipher_impl<StreamDecrypterImpl> DecrypterImpl;
 
-            return DecrypterImpl(r, CipherAccumulator(DecryptionMode(BlockCipher(key.key))));
+            return DecrypterImpl(r, key.key);
         }
     }    // namespace crypto3
 }    // namespace nil
@@ -73,9 +73,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamEncrypterImpl, OutputIterator> EncrypterImpl;
 
-            return EncrypterImpl(first, last, std::move(out),
-                                 CipherAccumulator(EncryptionMode(
-                                     BlockCipher(block::cipher_key<BlockCipher>(key_first, key_last).key))));
+            return EncrypterImpl(first, last, std::move(out), block::cipher_key<BlockCipher>(key_first, key_last).key);
         }
 
         /*!
@@ -107,9 +105,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamEncrypterImpl, OutputIterator> EncrypterImpl;
 
-            return EncrypterImpl(
-                first, last, std::move(out),
-                CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(first, last, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -140,7 +136,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamEncrypterImpl, OutputIterator> EncrypterImpl;
 
-            return EncrypterImpl(first, last, std::move(out), CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(first, last, std::move(out), key.key);
         }
 
         /*!
@@ -226,15 +222,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(InputIterator first, InputIterator last, KeyInputIterator key_first, KeyInputIterator key_last) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(first, last,
-                                 CipherAccumulator(EncryptionMode(
-                                     BlockCipher(block::cipher_key<BlockCipher>(key_first, key_last).key))));
+            return EncrypterImpl(first, last, block::cipher_key<BlockCipher>(key_first, key_last).key);
         }
 
         /*!
@@ -258,14 +249,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(InputIterator first, InputIterator last, const KeySinglePassRange &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(
-                first, last, CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(first, last, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -289,14 +276,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(InputIterator first, InputIterator last, std::initializer_list<K> key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(
-                first, last, CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(first, last, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -319,13 +302,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(InputIterator first, InputIterator last, const block::cipher_key<BlockCipher> &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(first, last, CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(first, last, key.key);
         }
 
         /*!
@@ -355,9 +335,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamEncrypterImpl, OutputIterator> EncrypterImpl;
 
-            return EncrypterImpl(
-                rng, std::move(out),
-                CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(rng, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -386,7 +364,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamEncrypterImpl, OutputIterator> EncrypterImpl;
 
-            return EncrypterImpl(rng, std::move(out), CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(rng, std::move(out), key.key);
         }
 
         /*!
@@ -414,9 +392,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(
-                rng, std::move(out),
-                CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(rng, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -443,7 +419,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(rng, std::move(out), CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(rng, std::move(out), key.key);
         }
 
         /*!
@@ -468,14 +444,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(const SinglePassRange &r, const KeySinglePassRange &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(
-                r, CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(r, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -497,13 +469,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(const SinglePassRange &r, const block::cipher_key<BlockCipher> &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(r, CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(r, key.key);
         }
 
         /*!
@@ -532,9 +501,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamEncrypterImpl, OutputIterator> EncrypterImpl;
 
-            return EncrypterImpl(
-                r, std::move(out),
-                CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(r, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -562,7 +529,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::itr_cipher_impl<StreamEncrypterImpl, OutputIterator> EncrypterImpl;
 
-            return EncrypterImpl(r, std::move(out), CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(r, std::move(out), key.key);
         }
 
         /*!
@@ -589,9 +556,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(
-                r, std::move(out),
-                CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(r, std::move(out), block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -617,7 +582,7 @@ namespace nil {
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(r, std::move(out), CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(r, std::move(out), key.key);
         }
 
         /*!
@@ -641,14 +606,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(std::initializer_list<T> il, std::initializer_list<K> key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(
-                il, CipherAccumulator(EncryptionMode(BlockCipher(block::cipher_key<BlockCipher>(key).key))));
+            return EncrypterImpl(il, block::cipher_key<BlockCipher>(key).key);
         }
 
         /*!
@@ -669,13 +630,10 @@ namespace nil {
         block::detail::range_cipher_impl<block::detail::value_cipher_impl<CipherAccumulator>>
             encrypt(std::initializer_list<SinglePassRange> r, const block::cipher_key<BlockCipher> &key) {
 
-            typedef typename block::modes::isomorphic<BlockCipher, block::nop_padding>::template bind<
-                block::encryption_policy<BlockCipher>>::type EncryptionMode;
-
             typedef block::detail::value_cipher_impl<CipherAccumulator> StreamEncrypterImpl;
             typedef block::detail::range_cipher_impl<StreamEncrypterImpl> EncrypterImpl;
 
-            return EncrypterImpl(r, CipherAccumulator(EncryptionMode(BlockCipher(key.key))));
+            return EncrypterImpl(r, key.key);
         }
     }    // namespace crypto3
 }    // namespace nil
@@ -79,7 +79,7 @@ namespace nil {
                 basic_shacal(const schedule_type &s) : schedule(s) {
                 }
 
-                virtual ~basic_shacal() {
+                ~basic_shacal() {
                     schedule.fill(0);
                 }
 
@@ -92,6 +92,18 @@ namespace nil {
                     return decrypt_block(schedule, ciphertext);
                 }
 
+                inline void encrypt_n(const block_type *plaintext, block_type *ciphertext, std::size_t n) const {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        ciphertext[i] = encrypt_block(schedule, plaintext[i]);
+                    }
+                }
+
+                inline void decrypt_n(const block_type *ciphertext, block_type *plaintext, std::size_t n) const {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        plaintext[i] = decrypt_block(schedule, ciphertext[i]);
+                    }
+                }
+
             private:
                 schedule_type schedule;
 
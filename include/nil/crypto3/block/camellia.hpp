@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_CAMELLIA_HPP
+#define CRYPTO3_BLOCK_CAMELLIA_HPP
+
+#include <nil/crypto3/block/detail/camellia/camellia_functions.hpp>
+
+#include <nil/crypto3/block/detail/block_stream_processor.hpp>
+#include <nil/crypto3/block/detail/cipher_modes.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @brief Camellia. A 128-bit Feistel cipher from NTT and Mitsubishi, standardized
+             * alongside AES in ISO/IEC 18033-3, NESSIE and CRYPTREC and used in TLS.
+             *
+             * @ingroup block
+             *
+             * Single blocks use SP tables. encrypt_n and decrypt_n run batches 16 blocks at a time
+             * through aesenclast where AES-NI is available.
+             *
+             * @tparam KeyBits Key length, one of 128, 192 or 256
+             */
+            template<std::size_t KeyBits>
+            class camellia {
+            protected:
+                typedef detail::camellia_functions<KeyBits> policy_type;
+
+                constexpr static const std::size_t key_schedule_size = policy_type::key_schedule_size;
+                typedef typename policy_type::key_schedule_type key_schedule_type;
+
+            public:
+                constexpr static const std::size_t rounds = policy_type::rounds;
+
+                constexpr static const std::size_t word_bits = policy_type::word_bits;
+                typedef typename policy_type::word_type word_type;
+
+                constexpr static const std::size_t block_bits = policy_type::block_bits;
+                constexpr static const std::size_t block_words = policy_type::block_words;
+                typedef typename policy_type::block_type block_type;
+
+                constexpr static const std::size_t key_bits = policy_type::key_bits;
+                constexpr static const std::size_t key_words = policy_type::key_words;
+                typedef typename policy_type::key_type key_type;
+
+                template<class Mode, typename StateAccumulator, std::size_t ValueBits>
+                struct stream_processor {
+                    struct params_type {
+
+                        constexpr static const std::size_t value_bits = ValueBits;
+                        constexpr static const std::size_t length_bits = policy_type::word_bits * 2;
+                    };
+
+                    typedef block_stream_processor<Mode, StateAccumulator, params_type> type;
+                };
+
+                // Camellia reads its halves big-endian
+                typedef typename stream_endian::big_octet_big_bit endian_type;
+
+                camellia(const key_type &key) {
+                    policy_type::schedule_key(key, encryption_key, decryption_key);
+                }
+
+                ~camellia() {
+                    encryption_key.fill(0);
+                    decryption_key.fill(0);
+                }
+
+                inline block_type encrypt(const block_type &plaintext) const {
+                    return policy_type::crypt_block(plaintext, encryption_key);
+                }
+
+                inline block_type decrypt(const block_type &ciphertext) const {
+                    return policy_type::crypt_block(ciphertext, decryption_key);
+                }
+
+                inline void encrypt_n(const block_type *plaintext, block_type *ciphertext, std::size_t n) const {
+                    policy_type::crypt_blocks(plaintext, ciphertext, n, encryption_key);
+                }
+
+                inline void decrypt_n(const block_type *ciphertext, block_type *plaintext, std::size_t n) const {
+                    policy_type::crypt_blocks(ciphertext, plaintext, n, decryption_key);
+                }
+
+            protected:
+                key_schedule_type encryption_key, decryption_key;
+            };
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_CAMELLIA_HPP
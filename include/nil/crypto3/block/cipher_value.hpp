@@ -27,7 +27,8 @@
 #define CRYPTO3_BLOCK_CIPHER_VALUE_HPP
 
 //#include <type_traits>
-//#include <iterator>
+#include <algorithm>
+#include <iterator>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
@@ -67,7 +68,13 @@ namespace nil {
                     typedef typename accumulator_type::mode_type mode_type;
                     typedef typename mode_type::cipher_type cipher_type;
 
-                    value_cipher_impl(const accumulator_set_type &acc) : accumulator_set(acc) {
+                    /*!
+                     * @brief Constructs the owned accumulator set from init, which is either an
+                     * accumulator set or a sample for it such as a mode or a cipher key. Passing the
+                     * key keys the cipher in place inside the mode, so no key schedule is copied.
+                     */
+                    template<typename Initializer>
+                    value_cipher_impl(const Initializer &init) : accumulator_set(init) {
                     }
 
                     mutable accumulator_set_type accumulator_set;
@@ -86,8 +93,8 @@ namespace nil {
                     typedef typename boost::mpl::apply<accumulator_set_type, accumulator_type>::type::result_type
                         result_type;
 
-                    template<typename SinglePassRange>
-                    range_cipher_impl(const SinglePassRange &range, const accumulator_set_type &ise) :
+                    template<typename SinglePassRange, typename Initializer>
+                    range_cipher_impl(const SinglePassRange &range, const Initializer &ise) :
                         CipherStateImpl(ise) {
                         BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
 
@@ -99,11 +106,13 @@ namespace nil {
                             std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
                             stream_processor;
 
+                        reserve(range.begin(), range.end(), stream_processor::value_bits);
+
                         stream_processor(this->accumulator_set)(range.begin(), range.end());
                     }
 
-                    template<typename InputIterator>
-                    range_cipher_impl(InputIterator first, InputIterator last, const accumulator_set_type &ise) :
+                    template<typename InputIterator, typename Initializer>
+                    range_cipher_impl(InputIterator first, InputIterator last, const Initializer &ise) :
                         CipherStateImpl(ise) {
                         BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<InputIterator>));
 
@@ -114,6 +123,8 @@ namespace nil {
                             std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
                             stream_processor;
 
+                        reserve(first, last, stream_processor::value_bits);
+
                         stream_processor(this->accumulator_set)(first, last);
                     }
 
@@ -159,6 +170,28 @@ namespace nil {
                     }
 
 #endif
+
+                protected:
+                    /*!
+                     * @brief Sizes the accumulated output up front when the input length is known in advance,
+                     * so encrypting long contiguous buffers doesn't reallocate the output block by block.
+                     */
+                    template<typename InputIterator>
+                    inline void reserve(InputIterator first, InputIterator last, std::size_t value_bits) {
+                        reserve(first, last, value_bits,
+                                typename std::iterator_traits<InputIterator>::iterator_category());
+                    }
+
+                    template<typename InputIterator>
+                    inline void reserve(InputIterator first, InputIterator last, std::size_t value_bits,
+                                        std::random_access_iterator_tag) {
+                        boost::accumulators::find_accumulator<accumulator_type>(this->accumulator_set)
+                            .reserve(std::distance(first, last) * value_bits);
+                    }
+
+                    template<typename InputIterator, typename IteratorCategory>
+                    inline void reserve(InputIterator, InputIterator, std::size_t, IteratorCategory) {
+                    }
                 };
 
                 template<typename CipherStateImpl, typename OutputIterator>
@@ -178,29 +211,42 @@ namespace nil {
                     typedef typename boost::mpl::apply<accumulator_set_type, accumulator_type>::type::result_type
                         result_type;
 
-                    template<typename SinglePassRange>
-                    itr_cipher_impl(const SinglePassRange &range, OutputIterator out, const accumulator_set_type &ise) :
+                    template<typename SinglePassRange, typename Initializer>
+                    itr_cipher_impl(const SinglePassRange &range, OutputIterator out, const Initializer &ise) :
                         CipherStateImpl(ise), out(std::move(out)) {
                         BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
 
-                        typedef
-                            typename std::iterator_traits<typename SinglePassRange::iterator>::value_type value_type;
-                        BOOST_STATIC_ASSERT(std::numeric_limits<value_type>::is_specialized);
-                        typedef typename cipher_type::template stream_processor<
-                            mode_type, accumulator_set_type,
-                            std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
-                            stream_processor;
-
-                        stream_processor(this->accumulator_set)(range.begin(), range.end());
+                        process(range.begin(), range.end());
                     }
 
-                    template<typename InputIterator>
+                    template<typename InputIterator, typename Initializer>
                     itr_cipher_impl(InputIterator first, InputIterator last, OutputIterator out,
-                                    const accumulator_set_type &ise) :
+                                    const Initializer &ise) :
                         CipherStateImpl(ise),
                         out(std::move(out)) {
                         BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<InputIterator>));
 
+                        process(first, last);
+                    }
+
+                    operator OutputIterator() const {
+                        result_type result =
+                            boost::accumulators::extract_result<accumulator_type>(this->accumulator_set);
+
+                        return std::move(result.cbegin(), result.cend(), out);
+                    }
+
+                protected:
+                    /*!
+                     * @brief Amount of blocks accumulated before they are written to the output iterator.
+                     * Ciphertext is emitted as the input is consumed, so memory use doesn't depend on the
+                     * message length. Authenticated decryptions are buffered whole instead: their output
+                     * is written only once the tag has been checked.
+                     */
+                    constexpr static const std::size_t flush_blocks = 256;
+
+                    template<typename InputIterator>
+                    inline void process(InputIterator first, InputIterator last) {
                         typedef typename std::iterator_traits<InputIterator>::value_type value_type;
                         BOOST_STATIC_ASSERT(std::numeric_limits<value_type>::is_specialized);
                         typedef typename cipher_type::template stream_processor<
@@ -208,14 +254,50 @@ namespace nil {
                             std::numeric_limits<value_type>::digits + std::numeric_limits<value_type>::is_signed>::type
                             stream_processor;
 
-                        stream_processor(this->accumulator_set)(first, last);
+                        boost::accumulators::find_accumulator<accumulator_type>(this->accumulator_set)
+                            .reserve(flush_blocks * cipher_type::block_bits);
+
+                        {
+                            stream_processor sp(this->accumulator_set);
+                            process(sp, first, last, stream_processor::block_values * flush_blocks,
+                                    typename std::iterator_traits<InputIterator>::iterator_category());
+                        }
+
+                        flush();
                     }
 
-                    operator OutputIterator() const {
-                        result_type result =
-                            boost::accumulators::extract_result<accumulator_type>(this->accumulator_set);
+                    template<typename StreamProcessor, typename InputIterator>
+                    inline void process(StreamProcessor &sp, InputIterator first, InputIterator last,
+                                        std::size_t chunk_values, std::random_access_iterator_tag) {
+                        while (first != last) {
+                            std::size_t n = std::min<std::size_t>(std::distance(first, last), chunk_values);
+                            sp(first, first + n);
+                            first += n;
+                            flush();
+                        }
+                    }
 
-                        return std::move(result.cbegin(), result.cend(), out);
+                    template<typename StreamProcessor, typename InputIterator, typename IteratorCategory>
+                    inline void process(StreamProcessor &sp, InputIterator first, InputIterator last,
+                                        std::size_t chunk_values, IteratorCategory) {
+                        while (first != last) {
+                            for (std::size_t n = 0; n != chunk_values && first != last; ++n) {
+                                sp(*first++);
+                            }
+                            flush();
+                        }
+                    }
+
+                    inline void flush() {
+                        flush(std::integral_constant<bool, is_authenticated_decryption<mode_type>::value>());
+                    }
+
+                    inline void flush(std::false_type) {
+                        out = boost::accumulators::find_accumulator<accumulator_type>(this->accumulator_set)
+                                  .flush(std::move(out));
+                    }
+
+                    inline void flush(std::true_type) {
                     }
                 };
             }    // namespace detail
@@ -0,0 +1,640 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_BLOCK_ARIA_FUNCTIONS_HPP
+#define CRYPTO3_BLOCK_ARIA_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include <boost/config.hpp>
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/block/detail/aria/aria_policy.hpp>
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#if (BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HAS_ARIA_AES_NI
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief ARIA rounds.
+                 *
+                 * The scalar rounds look substituted bytes up in tables that already do the diffusion
+                 * layer's mixing within each word; the mixing across words is done on whole words.
+                 *
+                 * Batches are byte-sliced instead: a 16x16 byte transposition puts byte j of 16
+                 * blocks into register j, and the diffusion layer becomes register XORs. SB1 and SB3
+                 * are the AES S-box and its inverse, evaluated on 16 bytes at once by aesenclast and
+                 * aesdeclast with a zero round key. SB2 is an affine map applied after the AES S-box
+                 * and SB4 one applied before its inverse, done with pshufb nibble tables.
+                 */
+                template<std::size_t KeyBits>
+                struct aria_functions : public aria_policy<KeyBits> {
+                    typedef aria_policy<KeyBits> policy_type;
+
+                    typedef typename policy_type::word_type word_type;
+
+                    typedef typename policy_type::block_type block_type;
+                    typedef typename policy_type::key_type key_type;
+
+                    constexpr static const std::size_t rounds = policy_type::rounds;
+                    constexpr static const std::size_t round_keys_size = policy_type::round_keys_size;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                    static inline word_type swap_byte_pairs(word_type x) {
+                        return ((x << 8) & 0xFF00FF00) | ((x >> 8) & 0x00FF00FF);
+                    }
+
+                    static inline word_type reverse_bytes(word_type x) {
+                        return swap_byte_pairs(policy_type::template rotr<16>(x));
+                    }
+
+                    /*!
+                     * @brief Looks the bytes of x up in the tables, starting with table first for the
+                     * most significant byte.
+                     */
+                    static inline word_type substitute(word_type x, std::size_t first) {
+                        return policy_type::table[(first % 4) << 8 | x >> 24] ^
+                               policy_type::table[((first + 1) % 4) << 8 | ((x >> 16) & 0xFF)] ^
+                               policy_type::table[((first + 2) % 4) << 8 | ((x >> 8) & 0xFF)] ^
+                               policy_type::table[((first + 3) % 4) << 8 | (x & 0xFF)];
+                    }
+
+                    // The diffusion layer's mixing of whole words, done before and after its byte permutations
+                    static inline void mix(word_type &T0, word_type &T1, word_type &T2, word_type &T3) {
+                        T1 ^= T2;
+                        T2 ^= T3;
+                        T0 ^= T1;
+                        T3 ^= T1;
+                        T2 ^= T0;
+                        T1 ^= T2;
+                    }
+
+                    // Substitution layer SL1 and the diffusion layer
+                    static inline void odd_round(word_type &T0, word_type &T1, word_type &T2, word_type &T3) {
+                        T0 = substitute(T0, 0);
+                        T1 = substitute(T1, 0);
+                        T2 = substitute(T2, 0);
+                        T3 = substitute(T3, 0);
+                        mix(T0, T1, T2, T3);
+                        T1 = swap_byte_pairs(T1);
+                        T2 = policy_type::template rotr<16>(T2);
+                        T3 = reverse_bytes(T3);
+                        mix(T0, T1, T2, T3);
+                    }
+
+                    /*!
+                     * @brief Substitution layer SL2 and the diffusion layer. Sharing the tables with SL1
+                     * leaves every word rotated by 16 bits, which the byte permutations take back.
+                     */
+                    static inline void even_round(word_type &T0, word_type &T1, word_type &T2, word_type &T3) {
+                        T0 = substitute(T0, 2);
+                        T1 = substitute(T1, 2);
+                        T2 = substitute(T2, 2);
+                        T3 = substitute(T3, 2);
+                        mix(T0, T1, T2, T3);
+                        T3 = swap_byte_pairs(T3);
+                        T0 = policy_type::template rotr<16>(T0);
+                        T1 = reverse_bytes(T1);
+                        mix(T0, T1, T2, T3);
+                    }
+
+                    // The last round substitutes by SL2 without diffusion
+                    static inline word_type last_round(word_type x) {
+                        return (policy_type::table[0x200 | x >> 24] & 0xFF000000) ^
+                               (policy_type::table[0x300 | ((x >> 16) & 0xFF)] & 0x00FF0000) ^
+                               (policy_type::table[(x >> 8) & 0xFF] & 0x0000FF00) ^
+                               (policy_type::table[0x100 | (x & 0xFF)] & 0x000000FF);
+                    }
+
+                    // The diffusion layer alone
+                    static inline void diffuse(block_type &T) {
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            T[i] = policy_type::template rotr<8>(T[i]) ^ policy_type::template rotr<16>(T[i]) ^
+                                   policy_type::template rotr<24>(T[i]);
+                        }
+                        mix(T[0], T[1], T[2], T[3]);
+                        T[1] = swap_byte_pairs(T[1]);
+                        T[2] = policy_type::template rotr<16>(T[2]);
+                        T[3] = reverse_bytes(T[3]);
+                        mix(T[0], T[1], T[2], T[3]);
+                    }
+
+                    /*!
+                     * @brief Runs a block through round_keys, the encryption or the decryption half of
+                     * the schedule: ARIA is an involution once the decryption keys went through the
+                     * diffusion layer.
+                     */
+                    static inline block_type crypt_block(const block_type &in, const word_type *round_keys) {
+                        const word_type *k = round_keys;
+                        word_type T0 = in[0], T1 = in[1], T2 = in[2], T3 = in[3];
+
+                        for (std::size_t r = 0; r != rounds - 2; r += 2, k += 8) {
+                            T0 ^= k[0];
+                            T1 ^= k[1];
+                            T2 ^= k[2];
+                            T3 ^= k[3];
+                            odd_round(T0, T1, T2, T3);
+                            T0 ^= k[4];
+                            T1 ^= k[5];
+                            T2 ^= k[6];
+                            T3 ^= k[7];
+                            even_round(T0, T1, T2, T3);
+                        }
+                        T0 ^= k[0];
+                        T1 ^= k[1];
+                        T2 ^= k[2];
+                        T3 ^= k[3];
+                        odd_round(T0, T1, T2, T3);
+
+                        return {{last_round(T0 ^ k[4]) ^ k[8], last_round(T1 ^ k[5]) ^ k[9],
+                                 last_round(T2 ^ k[6]) ^ k[10], last_round(T3 ^ k[7]) ^ k[11]}};
+                    }
+
+                    static void schedule_key(const key_type &key, key_schedule_type &schedule) {
+                        // The constants come in an order that depends on the key length
+                        const std::size_t first_constant = (KeyBits - 128) / 64;
+
+                        block_type W[4], KR = {{0, 0, 0, 0}};
+                        for (std::size_t i = 4; i < policy_type::key_words; ++i) {
+                            KR[i - 4] = key[i];
+                        }
+
+                        W[0] = {{key[0], key[1], key[2], key[3]}};
+                        W[1] = W[0];
+                        add_round_key(W[1], policy_type::constants.data() + 4 * first_constant);
+                        odd_round(W[1][0], W[1][1], W[1][2], W[1][3]);
+                        add_round_key(W[1], KR.data());
+                        W[2] = W[1];
+                        add_round_key(W[2], policy_type::constants.data() + 4 * ((first_constant + 1) % 3));
+                        even_round(W[2][0], W[2][1], W[2][2], W[2][3]);
+                        add_round_key(W[2], W[0].data());
+                        W[3] = W[2];
+                        add_round_key(W[3], policy_type::constants.data() + 4 * ((first_constant + 2) % 3));
+                        odd_round(W[3][0], W[3][1], W[3][2], W[3][3]);
+                        add_round_key(W[3], W[1].data());
+
+                        // Round key i is W[i % 4] xored with W[(i + 1) % 4] rotated right
+                        const std::size_t rotations[] = {19, 31, 67, 97, 109};
+                        word_type *encryption_keys = schedule.data();
+                        for (std::size_t i = 0; i <= rounds; ++i) {
+                            const block_type k = rotate_right(W[(i + 1) % 4], rotations[i / 4]);
+                            for (std::size_t j = 0; j != 4; ++j) {
+                                encryption_keys[4 * i + j] = W[i % 4][j] ^ k[j];
+                            }
+                        }
+
+                        word_type *decryption_keys = schedule.data() + round_keys_size;
+                        for (std::size_t i = 0; i <= rounds; ++i) {
+                            block_type k;
+                            std::copy(encryption_keys + 4 * (rounds - i), encryption_keys + 4 * (rounds - i + 1),
+                                      k.begin());
+                            if (i != 0 && i != rounds) {
+                                diffuse(k);
+                            }
+                            std::copy(k.begin(), k.end(), decryption_keys + 4 * i);
+                        }
+
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            W[i].fill(0);
+                        }
+                        KR.fill(0);
+                    }
+
+                    /*!
+                     * @brief Runs n blocks through round_keys, 32 at a time through VAES where the
+                     * processor has it, then 16 at a time through AES-NI.
+                     */
+                    static void crypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                             const word_type *round_keys) {
+#if defined(CRYPTO3_HAS_ARIA_AES_NI)
+                        if (n >= 32 && cpuid::has_avx2() && cpuid::has_vaes()) {
+                            for (; n >= 32; n -= 32, in += 32, out += 32) {
+                                crypt_32_blocks(in, out, round_keys);
+                            }
+                        }
+                        if (n >= 16 && cpuid::has_aes_ni() && cpuid::has_ssse3()) {
+                            for (; n >= 16; n -= 16, in += 16, out += 16) {
+                                crypt_16_blocks(in, out, round_keys);
+                            }
+                        }
+#endif
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = crypt_block(in[i], round_keys);
+                        }
+                    }
+
+#if defined(CRYPTO3_HAS_ARIA_AES_NI)
+                    /*
+                     * Byte-sliced blocks: register j holds byte j of every block. The diffusion layer
+                     * only XORs whole registers, so it serves 128-bit and 256-bit registers alike. All
+                     * helpers take constant register indices, which keeps the slices in registers.
+                     */
+
+                    // The diffusion layer's mixing within word w, each byte becoming the XOR of the other three
+                    template<typename T>
+                    static BOOST_FORCEINLINE void mix_word(T (&s)[16], std::size_t w) {
+                        const T t = s[w] ^ s[w + 1] ^ s[w + 2] ^ s[w + 3];
+                        s[w] ^= t;
+                        s[w + 1] ^= t;
+                        s[w + 2] ^= t;
+                        s[w + 3] ^= t;
+                    }
+
+                    // mix on byte b of the four words
+                    template<typename T>
+                    static BOOST_FORCEINLINE void mix_column(T (&s)[16], std::size_t b) {
+                        s[4 + b] ^= s[8 + b];
+                        s[8 + b] ^= s[12 + b];
+                        s[b] ^= s[4 + b];
+                        s[12 + b] ^= s[4 + b];
+                        s[8 + b] ^= s[b];
+                        s[4 + b] ^= s[8 + b];
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void mix_columns(T (&s)[16]) {
+                        mix_column(s, 0);
+                        mix_column(s, 1);
+                        mix_column(s, 2);
+                        mix_column(s, 3);
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void diffuse_slices(T (&s)[16]) {
+                        mix_word(s, 0);
+                        mix_word(s, 4);
+                        mix_word(s, 8);
+                        mix_word(s, 12);
+                        mix_columns(s);
+                        std::swap(s[4], s[5]);
+                        std::swap(s[6], s[7]);
+                        std::swap(s[8], s[10]);
+                        std::swap(s[9], s[11]);
+                        std::swap(s[12], s[15]);
+                        std::swap(s[13], s[14]);
+                        mix_columns(s);
+                    }
+
+                    /*!
+                     * @brief Index of the block a register lane holds after all rounds. aesenclast moves
+                     * the lanes of each register by ShiftRows. aesdeclast moves them back, so its input
+                     * goes through ShiftRows twice first: every round shuffles all registers alike by
+                     * ShiftRows, which undoes itself after four rounds.
+                     */
+                    static inline std::size_t lane_block(std::size_t i) {
+                        return rounds % 4 ? i % 4 + 4 * ((i / 4 + 2 * i) % 4) : i;
+                    }
+
+                    /*!
+                     * @brief Nibble tables of the affine maps, the constants folded into the low nibble
+                     * ones: 0 and 1 the map after the AES S-box giving SB2, 2 and 3 the map before the
+                     * inverse AES S-box giving SB4. 4 is a byte shuffle applying ShiftRows twice, 5 one
+                     * reversing the bytes of each word.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i constant(std::size_t i) {
+                        switch (i) {
+                            case 0:
+                                return _mm_set_epi64x(0x1A9FA52092172DA8, 0x3ABF8500B2370D88);
+                            case 1:
+                                return _mm_set_epi64x(0xA39D77492719F3CD, 0x6E50BA84EAD43E00);
+                            case 2:
+                                return _mm_set_epi64x(0xEBAA0140F8B91253, 0xBCFD5617AFEE4504);
+                            case 3:
+                                return _mm_set_epi64x(0x3B8D3385ED5BE553, 0x68DE60D6BE08B600);
+                            case 4:
+                                return _mm_set_epi8(7, 14, 5, 12, 3, 10, 1, 8, 15, 6, 13, 4, 11, 2, 9, 0);
+                            default:
+                                return _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i affine(__m128i x, std::size_t table) {
+                        const __m128i nibble = _mm_set1_epi8(0x0F);
+                        return _mm_xor_si128(
+                            _mm_shuffle_epi8(constant(table), _mm_and_si128(x, nibble)),
+                            _mm_shuffle_epi8(constant(table + 1), _mm_and_si128(_mm_srli_epi16(x, 4), nibble)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i sbox1(__m128i x) {
+                        return _mm_aesenclast_si128(x, _mm_setzero_si128());
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i sbox2(__m128i x) {
+                        return affine(sbox1(x), 0);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i sbox3(__m128i x) {
+                        return _mm_aesdeclast_si128(_mm_shuffle_epi8(x, constant(4)), _mm_setzero_si128());
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i sbox4(__m128i x) {
+                        return sbox3(affine(x, 2));
+                    }
+
+                    // Substitution layer SL1 on word w if Odd, else SL2
+                    template<bool Odd>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void substitute_word(__m128i (&s)[16], std::size_t w) {
+                        s[w] = Odd ? sbox1(s[w]) : sbox3(s[w]);
+                        s[w + 1] = Odd ? sbox2(s[w + 1]) : sbox4(s[w + 1]);
+                        s[w + 2] = Odd ? sbox3(s[w + 2]) : sbox1(s[w + 2]);
+                        s[w + 3] = Odd ? sbox4(s[w + 3]) : sbox2(s[w + 3]);
+                    }
+
+                    // Byte j of a round key is byte j ^ 3 in memory
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i key_byte(__m128i k, std::size_t i) {
+                        return _mm_shuffle_epi8(k, _mm_set1_epi8(static_cast<char>(i)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void add_key_word(__m128i (&s)[16], __m128i k, std::size_t w) {
+                        s[w] = _mm_xor_si128(s[w], key_byte(k, w + 3));
+                        s[w + 1] = _mm_xor_si128(s[w + 1], key_byte(k, w + 2));
+                        s[w + 2] = _mm_xor_si128(s[w + 2], key_byte(k, w + 1));
+                        s[w + 3] = _mm_xor_si128(s[w + 3], key_byte(k, w));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void add_round_key(__m128i (&s)[16], const word_type *k) {
+                        const __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i *>(k));
+                        add_key_word(s, key, 0);
+                        add_key_word(s, key, 4);
+                        add_key_word(s, key, 8);
+                        add_key_word(s, key, 12);
+                    }
+
+                    template<bool Odd>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void round(__m128i (&s)[16], const word_type *k, bool last = false) {
+                        add_round_key(s, k);
+                        substitute_word<Odd>(s, 0);
+                        substitute_word<Odd>(s, 4);
+                        substitute_word<Odd>(s, 8);
+                        substitute_word<Odd>(s, 12);
+                        if (!last) {
+                            diffuse_slices(s);
+                        }
+                    }
+
+                    // One step of the 16x16 byte transposition: y[2i] and y[2i + 1] interleave x[i] and x[i + 8]
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void interleave(const __m128i (&x)[16], __m128i (&y)[16], std::size_t i) {
+                        y[2 * i] = _mm_unpacklo_epi8(x[i], x[i + 8]);
+                        y[2 * i + 1] = _mm_unpackhi_epi8(x[i], x[i + 8]);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void interleave(const __m128i (&x)[16], __m128i (&y)[16]) {
+                        interleave(x, y, 0);
+                        interleave(x, y, 1);
+                        interleave(x, y, 2);
+                        interleave(x, y, 3);
+                        interleave(x, y, 4);
+                        interleave(x, y, 5);
+                        interleave(x, y, 6);
+                        interleave(x, y, 7);
+                    }
+
+                    // A 16x16 byte transposition, its own inverse
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void transpose(const __m128i (&x)[16], __m128i (&y)[16]) {
+                        __m128i t[16], u[16];
+                        interleave(x, t);
+                        interleave(t, u);
+                        interleave(u, t);
+                        interleave(t, y);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void crypt_16_blocks(const block_type *in, block_type *out, const word_type *round_keys) {
+                        // Words are stored least significant byte first
+                        __m128i x[16], s[16];
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            x[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i)),
+                                                    constant(5));
+                        }
+                        transpose(x, s);
+
+                        for (std::size_t r = 0; r != rounds - 2; r += 2) {
+                            round<true>(s, round_keys + 4 * r);
+                            round<false>(s, round_keys + 4 * r + 4);
+                        }
+                        round<true>(s, round_keys + 4 * (rounds - 2));
+                        round<false>(s, round_keys + 4 * (rounds - 1), true);
+                        add_round_key(s, round_keys + 4 * rounds);
+
+                        transpose(s, x);
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                                             _mm_shuffle_epi8(x[lane_block(i)], constant(5)));
+                        }
+                    }
+
+                    /*
+                     * The same kernel on 256-bit registers with VAES. Every instruction involved works
+                     * within 128-bit lanes, so a register carries two sets of 16 blocks.
+                     */
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i affine(__m256i x, std::size_t table) {
+                        const __m256i nibble = _mm256_set1_epi8(0x0F);
+                        return _mm256_xor_si256(
+                            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(constant(table)),
+                                                _mm256_and_si256(x, nibble)),
+                            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(constant(table + 1)),
+                                                _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i sbox1(__m256i x) {
+                        return _mm256_aesenclast_epi128(x, _mm256_setzero_si256());
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i sbox2(__m256i x) {
+                        return affine(sbox1(x), 0);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i sbox3(__m256i x) {
+                        const __m256i shift_rows_twice = _mm256_broadcastsi128_si256(constant(4));
+                        return _mm256_aesdeclast_epi128(_mm256_shuffle_epi8(x, shift_rows_twice),
+                                                        _mm256_setzero_si256());
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i sbox4(__m256i x) {
+                        return sbox3(affine(x, 2));
+                    }
+
+                    template<bool Odd>
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void substitute_word(__m256i (&s)[16], std::size_t w) {
+                        s[w] = Odd ? sbox1(s[w]) : sbox3(s[w]);
+                        s[w + 1] = Odd ? sbox2(s[w + 1]) : sbox4(s[w + 1]);
+                        s[w + 2] = Odd ? sbox3(s[w + 2]) : sbox1(s[w + 2]);
+                        s[w + 3] = Odd ? sbox4(s[w + 3]) : sbox2(s[w + 3]);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i key_byte(__m256i k, std::size_t i) {
+                        return _mm256_shuffle_epi8(k, _mm256_set1_epi8(static_cast<char>(i)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void add_key_word(__m256i (&s)[16], __m256i k, std::size_t w) {
+                        s[w] = _mm256_xor_si256(s[w], key_byte(k, w + 3));
+                        s[w + 1] = _mm256_xor_si256(s[w + 1], key_byte(k, w + 2));
+                        s[w + 2] = _mm256_xor_si256(s[w + 2], key_byte(k, w + 1));
+                        s[w + 3] = _mm256_xor_si256(s[w + 3], key_byte(k, w));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void add_round_key(__m256i (&s)[16], const word_type *k) {
+                        const __m256i key =
+                            _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(k)));
+                        add_key_word(s, key, 0);
+                        add_key_word(s, key, 4);
+                        add_key_word(s, key, 8);
+                        add_key_word(s, key, 12);
+                    }
+
+                    template<bool Odd>
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void round(__m256i (&s)[16], const word_type *k, bool last = false) {
+                        add_round_key(s, k);
+                        substitute_word<Odd>(s, 0);
+                        substitute_word<Odd>(s, 4);
+                        substitute_word<Odd>(s, 8);
+                        substitute_word<Odd>(s, 12);
+                        if (!last) {
+                            diffuse_slices(s);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void interleave(const __m256i (&x)[16], __m256i (&y)[16], std::size_t i) {
+                        y[2 * i] = _mm256_unpacklo_epi8(x[i], x[i + 8]);
+                        y[2 * i + 1] = _mm256_unpackhi_epi8(x[i], x[i + 8]);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void interleave(const __m256i (&x)[16], __m256i (&y)[16]) {
+                        interleave(x, y, 0);
+                        interleave(x, y, 1);
+                        interleave(x, y, 2);
+                        interleave(x, y, 3);
+                        interleave(x, y, 4);
+                        interleave(x, y, 5);
+                        interleave(x, y, 6);
+                        interleave(x, y, 7);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void transpose(const __m256i (&x)[16], __m256i (&y)[16]) {
+                        __m256i t[16], u[16];
+                        interleave(x, t);
+                        interleave(t, u);
+                        interleave(u, t);
+                        interleave(t, y);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static void crypt_32_blocks(const block_type *in, block_type *out, const word_type *round_keys) {
+                        const __m256i swap_words = _mm256_broadcastsi128_si256(constant(5));
+
+                        __m256i x[16], s[16];
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            x[i] = _mm256_shuffle_epi8(
+                                _mm256_inserti128_si256(
+                                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i))),
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16 + i)), 1),
+                                swap_words);
+                        }
+                        transpose(x, s);
+
+                        for (std::size_t r = 0; r != rounds - 2; r += 2) {
+                            round<true>(s, round_keys + 4 * r);
+                            round<false>(s, round_keys + 4 * r + 4);
+                        }
+                        round<true>(s, round_keys + 4 * (rounds - 2));
+                        round<false>(s, round_keys + 4 * (rounds - 1), true);
+                        add_round_key(s, round_keys + 4 * rounds);
+
+                        transpose(s, x);
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            const __m256i y = _mm256_shuffle_epi8(x[lane_block(i)], swap_words);
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm256_castsi256_si128(y));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16 + i), _mm256_extracti128_si256(y, 1));
+                        }
+                    }
+#endif
+
+                protected:
+                    static inline void add_round_key(block_type &T, const word_type *k) {
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            T[i] ^= k[i];
+                        }
+                    }
+
+                    // x as a 128-bit value, most significant word first, rotated right by n bits
+                    static inline block_type rotate_right(const block_type &x, std::size_t n) {
+                        const std::size_t words = n / 32, bits = n % 32;
+                        block_type result;
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            const word_type hi = x[(i + 4 - words) % 4], lo = x[(i + 3 - words) % 4];
+                            result[i] = bits ? (hi >> bits) | (lo << (32 - bits)) : hi;
+                        }
+                        return result;
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_ARIA_FUNCTIONS_HPP
@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_BLOCK_ARIA_POLICY_HPP
+#define CRYPTO3_BLOCK_ARIA_POLICY_HPP
+
+#include <array>
+#include <utility>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/basic_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief ARIA parameters and the tables of the scalar rounds, derived from the
+                 * S-boxes at compile time. The cipher works on 32-bit words, most significant byte
+                 * first.
+                 */
+                template<std::size_t KeyBits>
+                struct aria_policy : ::nil::crypto3::detail::basic_functions<32> {
+                    BOOST_STATIC_ASSERT_MSG(KeyBits == 128 || KeyBits == 192 || KeyBits == 256,
+                                            "ARIA key length is 128, 192 or 256 bits");
+
+                    constexpr static const std::size_t word_bits =
+                        ::nil::crypto3::detail::basic_functions<32>::word_bits;
+                    typedef typename ::nil::crypto3::detail::basic_functions<32>::word_type word_type;
+
+                    constexpr static const std::size_t block_bits = 128;
+                    constexpr static const std::size_t block_words = block_bits / word_bits;
+                    typedef std::array<word_type, block_words> block_type;
+
+                    constexpr static const std::size_t key_bits = KeyBits;
+                    constexpr static const std::size_t key_words = key_bits / word_bits;
+                    typedef std::array<word_type, key_words> key_type;
+
+                    constexpr static const std::size_t rounds = key_words + 8;
+
+                    // A round key before every round and one after the last
+                    constexpr static const std::size_t round_keys_size = block_words * (rounds + 1);
+
+                    // The encryption round keys followed by the decryption ones
+                    constexpr static const std::size_t key_schedule_size = 2 * round_keys_size;
+                    typedef std::array<word_type, key_schedule_size> key_schedule_type;
+
+                    // Schedules start on a cache line where heap allocations honour it too (aligned new)
+#if defined(__cpp_aligned_new)
+                    constexpr static const std::size_t key_schedule_alignment = 64;
+#else
+                    constexpr static const std::size_t key_schedule_alignment = 16;
+#endif
+
+                    constexpr static const std::size_t constants_size = 3 * block_words;
+                    typedef std::array<word_type, constants_size> constants_type;
+
+                    // CK1, CK2 and CK3, the first 384 bits of the fractional part of 1/pi
+                    constexpr static const constants_type constants = {
+                        0x517CC1B7, 0x27220A94, 0xFE13ABE8, 0xFA9A6EE0, 0x6DB14ACC, 0x9E21C820,
+                        0xFF28B1D5, 0xEF5DE2B0, 0xDB92371D, 0x2126E970, 0x03249775, 0x04E8C90E};
+
+                    constexpr static const std::size_t sbox_size = 256;
+                    typedef std::array<byte_type, sbox_size> substitution_type;
+
+                    // SB1, the AES S-box
+                    constexpr static const substitution_type substitution1 = {
+                        0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+                        0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+                        0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+                        0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+                        0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+                        0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+                        0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+                        0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+                        0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+                        0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+                        0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+                        0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+                        0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+                        0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+                        0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+                        0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16};
+
+                    // SB2, an affine map applied to x^247
+                    constexpr static const substitution_type substitution2 = {
+                        0xE2, 0x4E, 0x54, 0xFC, 0x94, 0xC2, 0x4A, 0xCC, 0x62, 0x0D, 0x6A, 0x46, 0x3C, 0x4D, 0x8B, 0xD1,
+                        0x5E, 0xFA, 0x64, 0xCB, 0xB4, 0x97, 0xBE, 0x2B, 0xBC, 0x77, 0x2E, 0x03, 0xD3, 0x19, 0x59, 0xC1,
+                        0x1D, 0x06, 0x41, 0x6B, 0x55, 0xF0, 0x99, 0x69, 0xEA, 0x9C, 0x18, 0xAE, 0x63, 0xDF, 0xE7, 0xBB,
+                        0x00, 0x73, 0x66, 0xFB, 0x96, 0x4C, 0x85, 0xE4, 0x3A, 0x09, 0x45, 0xAA, 0x0F, 0xEE, 0x10, 0xEB,
+                        0x2D, 0x7F, 0xF4, 0x29, 0xAC, 0xCF, 0xAD, 0x91, 0x8D, 0x78, 0xC8, 0x95, 0xF9, 0x2F, 0xCE, 0xCD,
+                        0x08, 0x7A, 0x88, 0x38, 0x5C, 0x83, 0x2A, 0x28, 0x47, 0xDB, 0xB8, 0xC7, 0x93, 0xA4, 0x12, 0x53,
+                        0xFF, 0x87, 0x0E, 0x31, 0x36, 0x21, 0x58, 0x48, 0x01, 0x8E, 0x37, 0x74, 0x32, 0xCA, 0xE9, 0xB1,
+                        0xB7, 0xAB, 0x0C, 0xD7, 0xC4, 0x56, 0x42, 0x26, 0x07, 0x98, 0x60, 0xD9, 0xB6, 0xB9, 0x11, 0x40,
+                        0xEC, 0x20, 0x8C, 0xBD, 0xA0, 0xC9, 0x84, 0x04, 0x49, 0x23, 0xF1, 0x4F, 0x50, 0x1F, 0x13, 0xDC,
+                        0xD8, 0xC0, 0x9E, 0x57, 0xE3, 0xC3, 0x7B, 0x65, 0x3B, 0x02, 0x8F, 0x3E, 0xE8, 0x25, 0x92, 0xE5,
+                        0x15, 0xDD, 0xFD, 0x17, 0xA9, 0xBF, 0xD4, 0x9A, 0x7E, 0xC5, 0x39, 0x67, 0xFE, 0x76, 0x9D, 0x43,
+                        0xA7, 0xE1, 0xD0, 0xF5, 0x68, 0xF2, 0x1B, 0x34, 0x70, 0x05, 0xA3, 0x8A, 0xD5, 0x79, 0x86, 0xA8,
+                        0x30, 0xC6, 0x51, 0x4B, 0x1E, 0xA6, 0x27, 0xF6, 0x35, 0xD2, 0x6E, 0x24, 0x16, 0x82, 0x5F, 0xDA,
+                        0xE6, 0x75, 0xA2, 0xEF, 0x2C, 0xB2, 0x1C, 0x9F, 0x5D, 0x6F, 0x80, 0x0A, 0x72, 0x44, 0x9B, 0x6C,
+                        0x90, 0x0B, 0x5B, 0x33, 0x7D, 0x5A, 0x52, 0xF3, 0x61, 0xA1, 0xF7, 0xB0, 0xD6, 0x3F, 0x7C, 0x6D,
+                        0xED, 0x14, 0xE0, 0xA5, 0x3D, 0x22, 0xB3, 0xF8, 0x89, 0xDE, 0x71, 0x1A, 0xAF, 0xBA, 0xB5, 0x81};
+
+                    constexpr static byte_type inverse(const substitution_type &sbox, byte_type y) {
+                        std::size_t x = 0;
+                        while (sbox[x] != y) {
+                            ++x;
+                        }
+                        return static_cast<byte_type>(x);
+                    }
+
+                    constexpr static const std::size_t table_size = 4 * sbox_size;
+                    typedef std::array<word_type, table_size> table_type;
+
+                    /*
+                     * S-box i + 1 in every byte of the word but byte i, most significant first, SB3 and
+                     * SB4 being the inverses of SB1 and SB2. Looked up for byte i of a word, this is the
+                     * substituted byte after the diffusion layer's mixing within the word.
+                     */
+                    constexpr static word_type table_entry(std::size_t i, byte_type x) {
+                        return i == 0 ? word_type(substitution1[x]) * 0x00010101 :
+                               i == 1 ? word_type(substitution2[x]) * 0x01000101 :
+                               i == 2 ? word_type(inverse(substitution1, x)) * 0x01010001 :
+                                        word_type(inverse(substitution2, x)) * 0x01010100;
+                    }
+
+                    template<std::size_t... I>
+                    constexpr static table_type make_table(std::index_sequence<I...>) {
+                        return {{table_entry(I / sbox_size, I % sbox_size)...}};
+                    }
+
+                    // table[256 * i + x] is table_entry(i, x)
+                    constexpr static const table_type table = make_table(std::make_index_sequence<table_size>());
+                };
+
+                template<std::size_t KeyBits>
+                constexpr const typename aria_policy<KeyBits>::constants_type aria_policy<KeyBits>::constants;
+
+                template<std::size_t KeyBits>
+                constexpr const typename aria_policy<KeyBits>::substitution_type aria_policy<KeyBits>::substitution1;
+
+                template<std::size_t KeyBits>
+                constexpr const typename aria_policy<KeyBits>::substitution_type aria_policy<KeyBits>::substitution2;
+
+                template<std::size_t KeyBits>
+                constexpr const typename aria_policy<KeyBits>::table_type aria_policy<KeyBits>::table;
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_ARIA_POLICY_HPP
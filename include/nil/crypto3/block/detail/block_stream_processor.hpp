@@ -26,9 +26,11 @@
 #ifndef CRYPTO3_BLOCK_BLOCK_STATE_PREPROCESSOR_HPP
 #define CRYPTO3_BLOCK_BLOCK_STATE_PREPROCESSOR_HPP
 
+#include <algorithm>
 #include <array>
 #include <iterator>
 #include <climits>
+#include <type_traits>
 
 #include <nil/crypto3/detail/pack.hpp>
 #include <nil/crypto3/detail/digest.hpp>
@@ -94,6 +96,28 @@ namespace nil {
                     acc(block, accumulators::bits = block_seen);
                 }
 
+                template<typename InputIterator>
+                inline void process_block(InputIterator p, std::true_type) {
+                    using namespace nil::crypto3::detail;
+
+                    block_type block;
+                    pack_to<endian_type, value_bits, actual_bits>(p, p + block_values, block.begin());
+                    acc(block, accumulators::bits = block_bits);
+                }
+
+                template<typename InputIterator>
+                inline void process_block(InputIterator p, std::false_type) {
+                    using namespace nil::crypto3::detail;
+
+                    // Values of another type are narrowed first so that packing doesn't sign-extend them
+                    cache_type values;
+                    std::copy(p, p + block_values, values.begin());
+
+                    block_type block;
+                    pack_to<endian_type, value_bits, actual_bits>(values.begin(), values.end(), block.begin());
+                    acc(block, accumulators::bits = block_bits);
+                }
+
             public:
                 inline void update_one(value_type value) {
                     cache[cache_seen] = value;
@@ -107,6 +131,17 @@ namespace nil {
 
                 template<typename InputIterator>
                 inline void update_n(InputIterator p, size_t n) {
+                    // Complete a partially filled cache first
+                    for (; n && cache_seen; --n) {
+                        update_one(*p++);
+                    }
+
+                    // Whole blocks are packed straight from the input, bypassing the cache
+                    for (; n >= block_values; n -= block_values, p += block_values) {
+                        process_block(p, std::is_same<typename std::iterator_traits<InputIterator>::value_type,
+                                                      value_type>());
+                    }
+
                     for (; n; --n) {
                         update_one(*p++);
                     }
@@ -122,7 +157,7 @@ namespace nil {
                 block_stream_processor(StateAccumulator &s) : acc(s), cache(cache_type()), cache_seen(0) {
                 }
 
-                virtual ~block_stream_processor() {
+                ~block_stream_processor() {
                     if (cache_seen != 0) {
                         process_block(cache_seen * value_bits);
                         cache_seen = 0;
@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_BASIC_CAMELLIA_POLICY_HPP
+#define CRYPTO3_BLOCK_BASIC_CAMELLIA_POLICY_HPP
+
+#include <array>
+
+#include <nil/crypto3/detail/basic_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief Camellia parameters shared by all key lengths. The cipher works on
+                 * 64-bit halves of the block, most significant byte first.
+                 */
+                template<std::size_t KeyBits>
+                struct basic_camellia_policy : ::nil::crypto3::detail::basic_functions<64> {
+                    constexpr static const std::size_t word_bits =
+                        ::nil::crypto3::detail::basic_functions<64>::word_bits;
+                    typedef typename ::nil::crypto3::detail::basic_functions<64>::word_type word_type;
+
+                    constexpr static const std::size_t block_bits = 128;
+                    constexpr static const std::size_t block_words = block_bits / word_bits;
+                    typedef std::array<word_type, block_words> block_type;
+
+                    constexpr static const std::size_t key_bits = KeyBits;
+                    constexpr static const std::size_t key_words = key_bits / word_bits;
+                    typedef std::array<word_type, key_words> key_type;
+
+                    constexpr static const std::size_t sigma_size = 6;
+                    typedef std::array<word_type, sigma_size> sigma_type;
+
+                    constexpr static const sigma_type sigma = {0xA09E667F3BCC908B, 0xB67AE8584CAA73B2,
+                                                               0xC6EF372FE94F82BE, 0x54FF53A5F1D36F1C,
+                                                               0x10E527FADE682D1D, 0xB05688C2B3E6C1FD};
+
+                    constexpr static const std::size_t sbox_size = 256;
+                    typedef std::array<byte_type, sbox_size> substitution_type;
+
+                    // SBOX1; the other three are rotations of its output or input
+                    constexpr static const substitution_type substitution = {
+                        0x70, 0x82, 0x2C, 0xEC, 0xB3, 0x27, 0xC0, 0xE5, 0xE4, 0x85, 0x57, 0x35, 0xEA, 0x0C, 0xAE, 0x41,
+                        0x23, 0xEF, 0x6B, 0x93, 0x45, 0x19, 0xA5, 0x21, 0xED, 0x0E, 0x4F, 0x4E, 0x1D, 0x65, 0x92, 0xBD,
+                        0x86, 0xB8, 0xAF, 0x8F, 0x7C, 0xEB, 0x1F, 0xCE, 0x3E, 0x30, 0xDC, 0x5F, 0x5E, 0xC5, 0x0B, 0x1A,
+                        0xA6, 0xE1, 0x39, 0xCA, 0xD5, 0x47, 0x5D, 0x3D, 0xD9, 0x01, 0x5A, 0xD6, 0x51, 0x56, 0x6C, 0x4D,
+                        0x8B, 0x0D, 0x9A, 0x66, 0xFB, 0xCC, 0xB0, 0x2D, 0x74, 0x12, 0x2B, 0x20, 0xF0, 0xB1, 0x84, 0x99,
+                        0xDF, 0x4C, 0xCB, 0xC2, 0x34, 0x7E, 0x76, 0x05, 0x6D, 0xB7, 0xA9, 0x31, 0xD1, 0x17, 0x04, 0xD7,
+                        0x14, 0x58, 0x3A, 0x61, 0xDE, 0x1B, 0x11, 0x1C, 0x32, 0x0F, 0x9C, 0x16, 0x53, 0x18, 0xF2, 0x22,
+                        0xFE, 0x44, 0xCF, 0xB2, 0xC3, 0xB5, 0x7A, 0x91, 0x24, 0x08, 0xE8, 0xA8, 0x60, 0xFC, 0x69, 0x50,
+                        0xAA, 0xD0, 0xA0, 0x7D, 0xA1, 0x89, 0x62, 0x97, 0x54, 0x5B, 0x1E, 0x95, 0xE0, 0xFF, 0x64, 0xD2,
+                        0x10, 0xC4, 0x00, 0x48, 0xA3, 0xF7, 0x75, 0xDB, 0x8A, 0x03, 0xE6, 0xDA, 0x09, 0x3F, 0xDD, 0x94,
+                        0x87, 0x5C, 0x83, 0x02, 0xCD, 0x4A, 0x90, 0x33, 0x73, 0x67, 0xF6, 0xF3, 0x9D, 0x7F, 0xBF, 0xE2,
+                        0x52, 0x9B, 0xD8, 0x26, 0xC8, 0x37, 0xC6, 0x3B, 0x81, 0x96, 0x6F, 0x4B, 0x13, 0xBE, 0x63, 0x2E,
+                        0xE9, 0x79, 0xA7, 0x8C, 0x9F, 0x6E, 0xBC, 0x8E, 0x29, 0xF5, 0xF9, 0xB6, 0x2F, 0xFD, 0xB4, 0x59,
+                        0x78, 0x98, 0x06, 0x6A, 0xE7, 0x46, 0x71, 0xBA, 0xD4, 0x25, 0xAB, 0x42, 0x88, 0xA2, 0x8D, 0xFA,
+                        0x72, 0x07, 0xB9, 0x55, 0xF8, 0xEE, 0xAC, 0x0A, 0x36, 0x49, 0x2A, 0x68, 0x3C, 0x38, 0xF1, 0xA4,
+                        0x40, 0x28, 0xD3, 0x7B, 0xBB, 0xC9, 0x43, 0xC1, 0x15, 0xE3, 0xAD, 0xF4, 0x77, 0xC7, 0x80, 0x9E};
+
+                    /*!
+                     * @brief Output bytes of the P-function that byte i of its input, most significant
+                     * first, contributes to.
+                     */
+                    typedef std::array<word_type, 8> permutation_masks_type;
+                    constexpr static const permutation_masks_type permutation_masks = {
+                        0xFFFFFF00FF0000FF, 0x00FFFFFFFFFF0000, 0xFF00FFFF00FFFF00, 0xFFFF00FF0000FFFF,
+                        0x00FFFFFF00FFFFFF, 0xFF00FFFFFF00FFFF, 0xFFFF00FFFFFF00FF, 0xFFFFFF00FFFFFF00};
+
+                    constexpr static byte_type rotate_byte_left(byte_type x, std::size_t n) {
+                        return static_cast<byte_type>((x << n) | (x >> (8 - n)));
+                    }
+
+                    /*!
+                     * @brief S-box applied to byte i of the F-function input: SBOX1 for bytes 0 and 7,
+                     * SBOX2 for 1 and 4, SBOX3 for 2 and 5 and SBOX4 for 3 and 6.
+                     */
+                    constexpr static byte_type sbox(std::size_t i, byte_type x) {
+                        return (i == 0 || i == 7) ? substitution[x] :
+                               (i == 1 || i == 4) ? rotate_byte_left(substitution[x], 1) :
+                               (i == 2 || i == 5) ? rotate_byte_left(substitution[x], 7) :
+                                                    substitution[rotate_byte_left(x, 1)];
+                    }
+                };
+
+                template<std::size_t KeyBits>
+                constexpr const typename basic_camellia_policy<KeyBits>::sigma_type
+                    basic_camellia_policy<KeyBits>::sigma;
+
+                template<std::size_t KeyBits>
+                constexpr const typename basic_camellia_policy<KeyBits>::substitution_type
+                    basic_camellia_policy<KeyBits>::substitution;
+
+                template<std::size_t KeyBits>
+                constexpr const typename basic_camellia_policy<KeyBits>::permutation_masks_type
+                    basic_camellia_policy<KeyBits>::permutation_masks;
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_BASIC_CAMELLIA_POLICY_HPP
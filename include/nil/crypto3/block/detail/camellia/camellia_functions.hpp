@@ -0,0 +1,469 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_CAMELLIA_FUNCTIONS_HPP
+#define CRYPTO3_BLOCK_CAMELLIA_FUNCTIONS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/config.hpp>
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/block/detail/camellia/camellia_policy.hpp>
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#if (BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HAS_CAMELLIA_AES_NI
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief Camellia rounds.
+                 *
+                 * The scalar F-function looks its eight S-box outputs up in SP tables with the
+                 * P-function already applied.
+                 *
+                 * Batches of 16 blocks are byte-sliced on AES-NI instead: a 16x16 byte transposition
+                 * puts byte j of all 16 blocks into register j. Camellia's SBOX1 is an affine map
+                 * around an inversion in a field isomorphic to the AES one. Each S-box is therefore
+                 * evaluated on 16 bytes at once by an affine map into the AES field, aesenclast with
+                 * a zero round key and an affine map back. SBOX2, SBOX3 and SBOX4 fold their bit
+                 * rotations into these maps. The P-function becomes 16 register XORs.
+                 */
+                template<std::size_t KeyBits>
+                struct camellia_functions : public camellia_policy<KeyBits> {
+                    typedef camellia_policy<KeyBits> policy_type;
+
+                    typedef typename policy_type::word_type word_type;
+
+                    typedef typename policy_type::block_type block_type;
+                    typedef typename policy_type::key_type key_type;
+
+                    constexpr static const std::size_t rounds = policy_type::rounds;
+                    constexpr static const std::size_t fl_layers = policy_type::fl_layers;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                    static inline word_type F(word_type x, word_type k) {
+                        x ^= k;
+                        return policy_type::sp[x >> 56] ^ policy_type::sp[0x100 | ((x >> 48) & 0xFF)] ^
+                               policy_type::sp[0x200 | ((x >> 40) & 0xFF)] ^
+                               policy_type::sp[0x300 | ((x >> 32) & 0xFF)] ^
+                               policy_type::sp[0x400 | ((x >> 24) & 0xFF)] ^
+                               policy_type::sp[0x500 | ((x >> 16) & 0xFF)] ^
+                               policy_type::sp[0x600 | ((x >> 8) & 0xFF)] ^ policy_type::sp[0x700 | (x & 0xFF)];
+                    }
+
+                    static inline word_type FL(word_type x, word_type k) {
+                        std::uint32_t x1 = static_cast<std::uint32_t>(x >> 32), x2 = static_cast<std::uint32_t>(x);
+                        const std::uint32_t k1 = static_cast<std::uint32_t>(k >> 32),
+                                            k2 = static_cast<std::uint32_t>(k);
+
+                        x2 ^= ::nil::crypto3::detail::basic_functions<32>::rotl<1>(x1 & k1);
+                        x1 ^= (x2 | k2);
+
+                        return (word_type(x1) << 32) | x2;
+                    }
+
+                    static inline word_type FLINV(word_type y, word_type k) {
+                        std::uint32_t y1 = static_cast<std::uint32_t>(y >> 32), y2 = static_cast<std::uint32_t>(y);
+                        const std::uint32_t k1 = static_cast<std::uint32_t>(k >> 32),
+                                            k2 = static_cast<std::uint32_t>(k);
+
+                        y1 ^= (y2 | k2);
+                        y2 ^= ::nil::crypto3::detail::basic_functions<32>::rotl<1>(y1 & k1);
+
+                        return (word_type(y1) << 32) | y2;
+                    }
+
+                    /*!
+                     * @brief Runs a block through the whitening, rounds and FL layers of schedule,
+                     * which encrypts with the encryption schedule and decrypts with the decryption one.
+                     */
+                    static inline block_type crypt_block(const block_type &in, const key_schedule_type &schedule) {
+                        const word_type *k = schedule.data() + 2;
+                        const word_type *fl = k + rounds;
+
+                        word_type D1 = in[0] ^ schedule[0], D2 = in[1] ^ schedule[1];
+
+                        for (std::size_t r = 0; r != rounds; r += 2) {
+                            D2 ^= F(D1, k[r]);
+                            D1 ^= F(D2, k[r + 1]);
+
+                            if ((r + 2) % 6 == 0 && r + 2 != rounds) {
+                                D1 = FL(D1, fl[0]);
+                                D2 = FLINV(D2, fl[1]);
+                                fl += 2;
+                            }
+                        }
+
+                        D2 ^= fl[0];
+                        D1 ^= fl[1];
+
+                        return {{D2, D1}};
+                    }
+
+                    static void schedule_key(const key_type &key, key_schedule_type &encryption_key,
+                                             key_schedule_type &decryption_key) {
+                        const word_type KL[2] = {key[0], key[1]};
+                        // The right half of the key, if any; 192-bit keys complete it with their complement
+                        word_type KR[2] = {0, 0};
+                        if (policy_type::key_words > 2) {
+                            KR[0] = key[2];
+                            KR[1] = policy_type::key_words == 4 ? key[policy_type::key_words - 1] : ~key[2];
+                        }
+
+                        word_type D1 = KL[0] ^ KR[0], D2 = KL[1] ^ KR[1];
+                        D2 ^= F(D1, policy_type::sigma[0]);
+                        D1 ^= F(D2, policy_type::sigma[1]);
+                        D1 ^= KL[0];
+                        D2 ^= KL[1];
+                        D2 ^= F(D1, policy_type::sigma[2]);
+                        D1 ^= F(D2, policy_type::sigma[3]);
+                        const word_type KA[2] = {D1, D2};
+
+                        D1 = KA[0] ^ KR[0];
+                        D2 = KA[1] ^ KR[1];
+                        D2 ^= F(D1, policy_type::sigma[4]);
+                        D1 ^= F(D2, policy_type::sigma[5]);
+                        const word_type KB[2] = {D1, D2};
+
+                        word_type *w = encryption_key.data();
+                        if (KeyBits == 128) {
+                            subkeys(w, KL, 0);      // kw1, kw2
+                            subkeys(w + 2, KA, 0);
+                            subkeys(w + 4, KL, 15);
+                            subkeys(w + 6, KA, 15);
+                            subkeys(w + 8, KL, 45);
+                            w[10] = subkey(KA, 45, 0);
+                            w[11] = subkey(KL, 60, 1);
+                            subkeys(w + 12, KA, 60);
+                            subkeys(w + 14, KL, 94);
+                            subkeys(w + 16, KA, 94);
+                            subkeys(w + 18, KL, 111);
+                            subkeys(w + 20, KA, 30);    // ke1, ke2
+                            subkeys(w + 22, KL, 77);    // ke3, ke4
+                            subkeys(w + 24, KA, 111);    // kw3, kw4
+                        } else {
+                            subkeys(w, KL, 0);    // kw1, kw2
+                            subkeys(w + 2, KB, 0);
+                            subkeys(w + 4, KR, 15);
+                            subkeys(w + 6, KA, 15);
+                            subkeys(w + 8, KB, 30);
+                            subkeys(w + 10, KL, 45);
+                            subkeys(w + 12, KA, 45);
+                            subkeys(w + 14, KR, 60);
+                            subkeys(w + 16, KB, 60);
+                            subkeys(w + 18, KL, 77);
+                            subkeys(w + 20, KR, 94);
+                            subkeys(w + 22, KA, 94);
+                            subkeys(w + 24, KL, 111);
+                            subkeys(w + 26, KR, 30);     // ke1, ke2
+                            subkeys(w + 28, KL, 60);     // ke3, ke4
+                            subkeys(w + 30, KA, 77);     // ke5, ke6
+                            subkeys(w + 32, KB, 111);    // kw3, kw4
+                        }
+
+                        // Decryption runs the same rounds with the whitening, round and FL keys reversed
+                        const std::size_t fl_begin = 2 + rounds, post = policy_type::key_schedule_size - 2;
+                        decryption_key[0] = encryption_key[post];
+                        decryption_key[1] = encryption_key[post + 1];
+                        for (std::size_t i = 0; i != rounds; ++i) {
+                            decryption_key[2 + i] = encryption_key[fl_begin - 1 - i];
+                        }
+                        for (std::size_t i = 0; i != 2 * fl_layers; ++i) {
+                            decryption_key[fl_begin + i] = encryption_key[post - 1 - i];
+                        }
+                        decryption_key[post] = encryption_key[0];
+                        decryption_key[post + 1] = encryption_key[1];
+                    }
+
+                    /*!
+                     * @brief Runs n blocks through schedule, 16 at a time where AES-NI is available.
+                     */
+                    static void crypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                             const key_schedule_type &schedule) {
+#if defined(CRYPTO3_HAS_CAMELLIA_AES_NI)
+                        if (n >= 16 && cpuid::has_aes_ni() && cpuid::has_ssse3()) {
+                            for (; n >= 16; n -= 16, in += 16, out += 16) {
+                                crypt_16_blocks(in, out, schedule);
+                            }
+                        }
+#endif
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = crypt_block(in[i], schedule);
+                        }
+                    }
+
+#if defined(CRYPTO3_HAS_CAMELLIA_AES_NI)
+                    /*!
+                     * @brief Nibble tables of the affine maps around aesenclast, the constants folded
+                     * into the low nibble ones. 0 to 3 are the low and high tables into the AES field,
+                     * for SBOX1 to SBOX3 and for SBOX4; 4 to 9 the ones back for SBOX1 and SBOX4,
+                     * SBOX2 and SBOX3.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i affine_table(std::size_t i) {
+                        switch (i) {
+                            case 0:
+                                return _mm_set_epi64x(0x0A0B1312BBBAA2A3, 0xA1A0B8B910110908);
+                            case 1:
+                                return _mm_set_epi64x(0x8C2B1FB8ED4A7ED9, 0x55F2C6613493A700);
+                            case 2:
+                                return _mm_set_epi64x(0xACB51D04071EB6AF, 0x0B12BAA3A0B91108);
+                            case 3:
+                                return _mm_set_epi64x(0x2AB94BD8F3609201, 0x2BB84AD9F2619300);
+                            case 4:
+                                return _mm_set_epi64x(0x58CBCD5E77E4E271, 0x38ABAD3E17848211);
+                            case 5:
+                                return _mm_set_epi64x(0x69D1B008C97110A8, 0xC17918A061D9B800);
+                            case 6:
+                                return _mm_set_epi64x(0xB0979BBCEEC9C5E2, 0x70575B7C2E090522);
+                            case 7:
+                                return _mm_set_epi64x(0xD2A3611093E22051, 0x83F23041C2B37100);
+                            case 8:
+                                return _mm_set_epi64x(0x2CE5E62FBB7271B8, 0x1CD5D61F8B424188);
+                            default:
+                                return _mm_set_epi64x(0xB4E85804E4B80854, 0xE0BC0C50B0EC5C00);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i affine(__m128i x, std::size_t table) {
+                        const __m128i nibble = _mm_set1_epi8(0x0F);
+                        return _mm_xor_si128(
+                            _mm_shuffle_epi8(affine_table(table), _mm_and_si128(x, nibble)),
+                            _mm_shuffle_epi8(affine_table(table + 1), _mm_and_si128(_mm_srli_epi16(x, 4), nibble)));
+                    }
+
+                    /*!
+                     * @brief The S-box applied to byte I of the F-function input, on 16 blocks. The
+                     * input is permuted first to cancel the ShiftRows done by aesenclast.
+                     */
+                    template<std::size_t I>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i substitute(__m128i x) {
+                        const __m128i inverse_shift_rows =
+                            _mm_set_epi8(3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0);
+
+                        x = affine(_mm_shuffle_epi8(x, inverse_shift_rows), (I == 3 || I == 6) ? 2 : 0);
+                        x = _mm_aesenclast_si128(x, _mm_setzero_si128());
+                        return affine(x, (I == 1 || I == 4) ? 6 : (I == 2 || I == 5) ? 8 : 4);
+                    }
+
+                    // Byte I of k, most significant first, in every byte
+                    template<std::size_t I>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i key_byte(__m128i k) {
+                        return _mm_shuffle_epi8(k, _mm_set1_epi8(static_cast<char>(7 - I)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i load_key(const word_type &k) {
+                        return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&k));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void whiten(__m128i (&D)[8], const word_type &k) {
+                        const __m128i kw = load_key(k);
+                        D[0] = _mm_xor_si128(D[0], key_byte<0>(kw));
+                        D[1] = _mm_xor_si128(D[1], key_byte<1>(kw));
+                        D[2] = _mm_xor_si128(D[2], key_byte<2>(kw));
+                        D[3] = _mm_xor_si128(D[3], key_byte<3>(kw));
+                        D[4] = _mm_xor_si128(D[4], key_byte<4>(kw));
+                        D[5] = _mm_xor_si128(D[5], key_byte<5>(kw));
+                        D[6] = _mm_xor_si128(D[6], key_byte<6>(kw));
+                        D[7] = _mm_xor_si128(D[7], key_byte<7>(kw));
+                    }
+
+                    // out ^= F(in, k) on 16 byte-sliced blocks
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void round(const __m128i (&in)[8], __m128i (&out)[8], const word_type &k) {
+                        const __m128i kv = load_key(k);
+
+                        __m128i z0 = substitute<0>(_mm_xor_si128(in[0], key_byte<0>(kv)));
+                        __m128i z1 = substitute<1>(_mm_xor_si128(in[1], key_byte<1>(kv)));
+                        __m128i z2 = substitute<2>(_mm_xor_si128(in[2], key_byte<2>(kv)));
+                        __m128i z3 = substitute<3>(_mm_xor_si128(in[3], key_byte<3>(kv)));
+                        __m128i z4 = substitute<4>(_mm_xor_si128(in[4], key_byte<4>(kv)));
+                        __m128i z5 = substitute<5>(_mm_xor_si128(in[5], key_byte<5>(kv)));
+                        __m128i z6 = substitute<6>(_mm_xor_si128(in[6], key_byte<6>(kv)));
+                        __m128i z7 = substitute<7>(_mm_xor_si128(in[7], key_byte<7>(kv)));
+
+                        // P-function, which leaves the two halves of its output swapped
+                        z0 = _mm_xor_si128(z0, z5);
+                        z1 = _mm_xor_si128(z1, z6);
+                        z2 = _mm_xor_si128(z2, z7);
+                        z3 = _mm_xor_si128(z3, z4);
+                        z4 = _mm_xor_si128(z4, z2);
+                        z5 = _mm_xor_si128(z5, z3);
+                        z6 = _mm_xor_si128(z6, z0);
+                        z7 = _mm_xor_si128(z7, z1);
+                        z0 = _mm_xor_si128(z0, z7);
+                        z1 = _mm_xor_si128(z1, z4);
+                        z2 = _mm_xor_si128(z2, z5);
+                        z3 = _mm_xor_si128(z3, z6);
+                        z4 = _mm_xor_si128(z4, z3);
+                        z5 = _mm_xor_si128(z5, z0);
+                        z6 = _mm_xor_si128(z6, z1);
+                        z7 = _mm_xor_si128(z7, z2);
+
+                        out[0] = _mm_xor_si128(out[0], z4);
+                        out[1] = _mm_xor_si128(out[1], z5);
+                        out[2] = _mm_xor_si128(out[2], z6);
+                        out[3] = _mm_xor_si128(out[3], z7);
+                        out[4] = _mm_xor_si128(out[4], z0);
+                        out[5] = _mm_xor_si128(out[5], z1);
+                        out[6] = _mm_xor_si128(out[6], z2);
+                        out[7] = _mm_xor_si128(out[7], z3);
+                    }
+
+                    // x1 ^= (x2 | k2) for the 32-bit halves x1 = D[0..3], x2 = D[4..7]
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void fl_or(__m128i (&D)[8], __m128i k) {
+                        D[0] = _mm_xor_si128(D[0], _mm_or_si128(D[4], key_byte<4>(k)));
+                        D[1] = _mm_xor_si128(D[1], _mm_or_si128(D[5], key_byte<5>(k)));
+                        D[2] = _mm_xor_si128(D[2], _mm_or_si128(D[6], key_byte<6>(k)));
+                        D[3] = _mm_xor_si128(D[3], _mm_or_si128(D[7], key_byte<7>(k)));
+                    }
+
+                    // x2 ^= (x1 & k1) <<< 1, the rotation carrying the top bit of each byte into the next
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void fl_and(__m128i (&D)[8], __m128i k) {
+                        const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi8(1);
+
+                        const __m128i t0 = _mm_and_si128(D[0], key_byte<0>(k));
+                        const __m128i t1 = _mm_and_si128(D[1], key_byte<1>(k));
+                        const __m128i t2 = _mm_and_si128(D[2], key_byte<2>(k));
+                        const __m128i t3 = _mm_and_si128(D[3], key_byte<3>(k));
+
+                        const __m128i c0 = _mm_and_si128(_mm_cmpgt_epi8(zero, t0), one);
+                        const __m128i c1 = _mm_and_si128(_mm_cmpgt_epi8(zero, t1), one);
+                        const __m128i c2 = _mm_and_si128(_mm_cmpgt_epi8(zero, t2), one);
+                        const __m128i c3 = _mm_and_si128(_mm_cmpgt_epi8(zero, t3), one);
+
+                        D[4] = _mm_xor_si128(D[4], _mm_or_si128(_mm_add_epi8(t0, t0), c1));
+                        D[5] = _mm_xor_si128(D[5], _mm_or_si128(_mm_add_epi8(t1, t1), c2));
+                        D[6] = _mm_xor_si128(D[6], _mm_or_si128(_mm_add_epi8(t2, t2), c3));
+                        D[7] = _mm_xor_si128(D[7], _mm_or_si128(_mm_add_epi8(t3, t3), c0));
+                    }
+
+                    // A 16x16 byte transposition, its own inverse
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void transpose(__m128i (&x)[16]) {
+                        for (std::size_t pass = 0; pass != 4; ++pass) {
+                            __m128i y[16];
+                            for (std::size_t i = 0; i != 8; ++i) {
+                                y[2 * i] = _mm_unpacklo_epi8(x[i], x[i + 8]);
+                                y[2 * i + 1] = _mm_unpackhi_epi8(x[i], x[i + 8]);
+                            }
+                            for (std::size_t i = 0; i != 16; ++i) {
+                                x[i] = y[i];
+                            }
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void crypt_16_blocks(const block_type *in, block_type *out,
+                                                const key_schedule_type &schedule) {
+                        const word_type *k = schedule.data() + 2;
+                        const word_type *fl = k + rounds;
+
+                        __m128i x[16];
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            x[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                        }
+                        transpose(x);
+
+                        // Words are stored least significant byte first
+                        __m128i D1[8], D2[8];
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            D1[i] = x[7 - i];
+                            D2[i] = x[15 - i];
+                        }
+
+                        whiten(D1, schedule[0]);
+                        whiten(D2, schedule[1]);
+
+                        for (std::size_t r = 0; r != rounds; r += 2) {
+                            round(D1, D2, k[r]);
+                            round(D2, D1, k[r + 1]);
+
+                            if ((r + 2) % 6 == 0 && r + 2 != rounds) {
+                                const __m128i k1 = load_key(fl[0]), k2 = load_key(fl[1]);
+                                fl_and(D1, k1);
+                                fl_or(D1, k1);
+                                fl_or(D2, k2);
+                                fl_and(D2, k2);
+                                fl += 2;
+                            }
+                        }
+
+                        whiten(D2, fl[0]);
+                        whiten(D1, fl[1]);
+
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            x[7 - i] = D2[i];
+                            x[15 - i] = D1[i];
+                        }
+                        transpose(x);
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), x[i]);
+                        }
+                    }
+#endif
+
+                protected:
+                    // Half of source rotated left by rotation bits, as a 128-bit value
+                    static inline word_type subkey(const word_type (&source)[2], std::size_t rotation,
+                                                   std::size_t half) {
+                        const std::size_t words = rotation / 64, bits = rotation % 64;
+                        const word_type hi = source[(half + words) % 2], lo = source[(half + words + 1) % 2];
+                        return bits ? (hi << bits) | (lo >> (64 - bits)) : hi;
+                    }
+
+                    static inline void subkeys(word_type *out, const word_type (&source)[2], std::size_t rotation) {
+                        out[0] = subkey(source, rotation, 0);
+                        out[1] = subkey(source, rotation, 1);
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_CAMELLIA_FUNCTIONS_HPP
@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_CAMELLIA_POLICY_HPP
+#define CRYPTO3_BLOCK_CAMELLIA_POLICY_HPP
+
+#include <utility>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/block/detail/camellia/basic_camellia_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief Key length dependent Camellia parameters and the SP tables of the scalar
+                 * F-function, derived from the S-boxes at compile time.
+                 */
+                template<std::size_t KeyBits>
+                struct camellia_policy : public basic_camellia_policy<KeyBits> {
+                    typedef basic_camellia_policy<KeyBits> policy_type;
+
+                    BOOST_STATIC_ASSERT_MSG(KeyBits == 128 || KeyBits == 192 || KeyBits == 256,
+                                            "Camellia key length is 128, 192 or 256 bits");
+
+                    typedef typename policy_type::word_type word_type;
+                    typedef typename policy_type::byte_type byte_type;
+
+                    constexpr static const std::size_t rounds = KeyBits == 128 ? 18 : 24;
+
+                    // An FL/FL^-1 layer follows every six rounds but the last ones
+                    constexpr static const std::size_t fl_layers = rounds / 6 - 1;
+
+                    /*
+                     * Two whitening words before the rounds, the round keys, two words per FL layer
+                     * and two whitening words after the rounds.
+                     */
+                    constexpr static const std::size_t key_schedule_size = 2 + rounds + 2 * fl_layers + 2;
+                    typedef std::array<word_type, key_schedule_size> key_schedule_type;
+
+                    constexpr static const std::size_t sp_size = 8 * policy_type::sbox_size;
+                    typedef std::array<word_type, sp_size> sp_type;
+
+                    constexpr static word_type sp_entry(std::size_t i, byte_type x) {
+                        return policy_type::permutation_masks[i] &
+                               (word_type(policy_type::sbox(i, x)) * 0x0101010101010101);
+                    }
+
+                    template<std::size_t... I>
+                    constexpr static sp_type make_sp(std::index_sequence<I...>) {
+                        return {{sp_entry(I / policy_type::sbox_size, I % policy_type::sbox_size)...}};
+                    }
+
+                    // SP[256 * i + x] is the P-function applied to SBOX(i, x) placed in byte i
+                    constexpr static const sp_type sp = make_sp(std::make_index_sequence<sp_size>());
+                };
+
+                template<std::size_t KeyBits>
+                constexpr const typename camellia_policy<KeyBits>::sp_type camellia_policy<KeyBits>::sp;
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_CAMELLIA_POLICY_HPP
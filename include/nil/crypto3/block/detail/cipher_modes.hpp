@@ -27,6 +27,23 @@
 #define CRYPTO3_CIPHER_MODES_HPP
 
 #include <nil/crypto3/detail/stream_endian.hpp>
+#include <nil/crypto3/detail/pack.hpp>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/block/detail/ghash/ghash.hpp>
+#include <nil/crypto3/block/detail/polyval/polyval.hpp>
+#include <nil/crypto3/block/detail/xts/xts_tweak.hpp>
+#include <nil/crypto3/block/detail/utilities/memory_operations.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace nil {
     namespace crypto3 {
@@ -107,6 +124,13 @@ namespace nil {
                     isomorphic(const cipher_type &cipher) : cipher(cipher) {
                     }
 
+                    /*!
+                     * @brief Keys the cipher in place, so that an accumulator constructed from the key
+                     * holds the only copy of the key schedule.
+                     */
+                    explicit isomorphic(const key_type &key) : cipher(key) {
+                    }
+
                     block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
                         return policy_type::begin_message(cipher, plaintext);
                     }
@@ -122,21 +146,2125 @@ namespace nil {
                 protected:
                     cipher_type cipher;
                 };
-            }    // namespace detail
 
-            namespace modes {
+                template<typename Cipher, typename Padding>
+                struct cbc_policy : public isomorphic_policy<Cipher, Padding> {
+                    typedef typename isomorphic_policy<Cipher, Padding>::size_type size_type;
+                    typedef typename isomorphic_policy<Cipher, Padding>::block_type block_type;
+
+                    /*!
+                     * @brief Amount of blocks decrypted per cipher invocation. Unlike ctr there is no
+                     * keystream to precompute, so larger batches only amortize the call and keep the
+                     * VAES kernel in its four-register loop. Encryption of a single message is serial
+                     * and processes one block at a time.
+                     */
+                    constexpr static const size_type pipeline_blocks = 64;
+
+                    /*!
+                     * @brief Amount of independent messages encrypted in lockstep by process_messages,
+                     * one block of each per cipher invocation.
+                     */
+                    constexpr static const size_type interleaved_messages = 16;
+
+                    typedef typename isomorphic_policy<Cipher, Padding>::endian_type endian_type;
+
+                    constexpr static const size_type value_bits =
+                        sizeof(typename block_type::value_type) * CHAR_BIT;
+                    constexpr static const size_type block_bytes =
+                        isomorphic_policy<Cipher, Padding>::block_bits / CHAR_BIT;
+
+                    inline static block_type xor_block(const block_type &a, const block_type &b) {
+                        block_type result;
+                        for (size_type i = 0; i != a.size(); ++i) {
+                            result[i] = a[i] ^ b[i];
+                        }
+                        return result;
+                    }
+
+                    inline static block_type load_block(const std::uint8_t *bytes) {
+                        block_type block;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, CHAR_BIT, value_bits>(
+                            bytes, bytes + block_bytes, block.begin());
+                        return block;
+                    }
+
+                    inline static void store_block(const block_type &block, std::uint8_t *bytes) {
+                        std::array<std::uint8_t, block_bytes> packed;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, value_bits, CHAR_BIT>(
+                            block.begin(), block.end(), packed.begin());
+                        std::copy(packed.begin(), packed.end(), bytes);
+                    }
+
+                    inline static size_type message_blocks(size_type bytes) {
+                        if (bytes % block_bytes != 0) {
+                            throw std::invalid_argument("cbc message is not a multiple of the block size");
+                        }
+                        return bytes / block_bytes;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct cbc_encryption_policy : public cbc_policy<Cipher, Padding> {
+                    typedef typename cbc_policy<Cipher, Padding>::cipher_type cipher_type;
+                    typedef typename cbc_policy<Cipher, Padding>::block_type block_type;
+
+                    inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
+                                                           block_type &chain) {
+                        chain = cipher.encrypt(cbc_policy<Cipher, Padding>::xor_block(plaintext, chain));
+                        return chain;
+                    }
+
+                    inline static void process_n(const cipher_type &cipher, const block_type *plaintext,
+                                                 block_type *ciphertext, std::size_t n, block_type &chain) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            ciphertext[i] = process_block(cipher, plaintext[i], chain);
+                        }
+                    }
+
+                    /*!
+                     * @brief Encrypts independent messages in lockstep, one block of each of up to
+                     * policy_type::interleaved_messages messages per cipher call. A finished message
+                     * frees its lane for the next one, so short messages do not stall the others.
+                     */
+                    template<typename InputIterator>
+                    static void process_messages(const cipher_type &cipher, InputIterator first, InputIterator last) {
+                        typedef cbc_policy<Cipher, Padding> policy_type;
+
+                        struct lane_type {
+                            block_type chain;
+                            std::uint8_t *data;
+                            std::size_t blocks;
+                        };
+
+                        std::array<lane_type, policy_type::interleaved_messages> lanes;
+                        std::array<block_type, policy_type::interleaved_messages> input, output;
+                        std::size_t active = 0;
+
+                        while (true) {
+                            for (; active != lanes.size() && first != last; ++first) {
+                                const std::size_t blocks = policy_type::message_blocks(first->second.size());
+                                if (blocks != 0) {
+                                    lanes[active++] = {first->first, first->second.data(), blocks};
+                                }
+                            }
+
+                            if (active == 0) {
+                                break;
+                            }
+
+                            for (std::size_t i = 0; i != active; ++i) {
+                                input[i] =
+                                    policy_type::xor_block(policy_type::load_block(lanes[i].data), lanes[i].chain);
+                            }
+
+                            cipher.encrypt_n(input.data(), output.data(), active);
+
+                            for (std::size_t i = 0; i != active;) {
+                                policy_type::store_block(output[i], lanes[i].data);
+                                lanes[i].chain = output[i];
+                                lanes[i].data += policy_type::block_bytes;
+
+                                if (--lanes[i].blocks == 0) {
+                                    --active;
+                                    lanes[i] = lanes[active];
+                                    output[i] = output[active];
+                                } else {
+                                    ++i;
+                                }
+                            }
+                        }
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct cbc_decryption_policy : public cbc_policy<Cipher, Padding> {
+                    typedef cbc_policy<Cipher, Padding> policy_type;
+
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::block_type block_type;
+
+                    inline static block_type process_block(const cipher_type &cipher, const block_type &ciphertext,
+                                                           block_type &chain) {
+                        const block_type plaintext = policy_type::xor_block(cipher.decrypt(ciphertext), chain);
+                        chain = ciphertext;
+                        return plaintext;
+                    }
+
+                    /*!
+                     * @brief Decrypts policy_type::pipeline_blocks independent blocks per cipher call and
+                     * then xors each with the preceding ciphertext block. In-place operation is allowed.
+                     */
+                    inline static void process_n(const cipher_type &cipher, const block_type *ciphertext,
+                                                 block_type *plaintext, std::size_t n, block_type &chain) {
+                        std::array<block_type, policy_type::pipeline_blocks> decrypted;
+
+                        while (n != 0) {
+                            const std::size_t blocks =
+                                n < policy_type::pipeline_blocks ? n : policy_type::pipeline_blocks;
+
+                            cipher.decrypt_n(ciphertext, decrypted.data(), blocks);
+
+                            // Back to front, so that in-place output overwrites only consumed ciphertext
+                            const block_type next_chain = ciphertext[blocks - 1];
+                            for (std::size_t i = blocks - 1; i != 0; --i) {
+                                plaintext[i] = policy_type::xor_block(decrypted[i], ciphertext[i - 1]);
+                            }
+                            plaintext[0] = policy_type::xor_block(decrypted[0], chain);
+                            chain = next_chain;
+
+                            ciphertext += blocks;
+                            plaintext += blocks;
+                            n -= blocks;
+                        }
+                    }
+
+                    /*!
+                     * @brief Decrypts independent messages one after another, each through process_n.
+                     */
+                    template<typename InputIterator>
+                    static void process_messages(const cipher_type &cipher, InputIterator first, InputIterator last) {
+                        std::array<block_type, policy_type::pipeline_blocks> blocks;
+
+                        for (; first != last; ++first) {
+                            block_type chain = first->first;
+                            std::uint8_t *data = first->second.data();
+
+                            for (std::size_t left = policy_type::message_blocks(first->second.size()); left != 0;) {
+                                const std::size_t n = left < blocks.size() ? left : blocks.size();
+
+                                for (std::size_t i = 0; i != n; ++i) {
+                                    blocks[i] = policy_type::load_block(data + i * policy_type::block_bytes);
+                                }
+                                process_n(cipher, blocks.data(), blocks.data(), n, chain);
+                                for (std::size_t i = 0; i != n; ++i) {
+                                    policy_type::store_block(blocks[i], data + i * policy_type::block_bytes);
+                                }
+
+                                data += n * policy_type::block_bytes;
+                                left -= n;
+                            }
+                        }
+                    }
+                };
+
+                /*!
+                 * @brief Cipher block chaining mode. Encryption is serial, decryption is not: whole
+                 * buffers passed to process_n are decrypted policy_type::pipeline_blocks blocks at a time.
+                 */
+                template<typename Policy>
+                class cbc {
+                    typedef Policy policy_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    cbc(const cipher_type &cipher, const block_type &iv = block_type()) : cipher(cipher), chain(iv) {
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return policy_type::process_block(cipher, plaintext, chain);
+                    }
+
+                    block_type process_block(const block_type &plaintext, std::size_t total_seen) {
+                        return policy_type::process_block(cipher, plaintext, chain);
+                    }
+
+                    block_type end_message(const block_type &plaintext, std::size_t total_seen) const {
+                        block_type last_chain = chain;
+                        return policy_type::process_block(cipher, plaintext, last_chain);
+                    }
+
+                    /*!
+                     * @brief Processes n whole blocks, continuing the chain of previous calls.
+                     */
+                    void process_n(const block_type *input, block_type *output, std::size_t n) {
+                        policy_type::process_n(cipher, input, output, n, chain);
+                    }
+
+                    /*!
+                     * @brief Processes a batch of independent messages in place. Each element is a pair of
+                     * an IV and a contiguous byte container, such as std::pair<block_type,
+                     * std::vector<std::uint8_t>>. The chain of the mode itself is left untouched.
+                     * @throws std::invalid_argument if a message is not a multiple of the block size. All
+                     * lengths are checked before any data is processed, so no message is changed then.
+                     */
+                    template<typename ForwardIterator>
+                    void process_messages(ForwardIterator first, ForwardIterator last) const {
+                        for (ForwardIterator it = first; it != last; ++it) {
+                            policy_type::message_blocks(it->second.size());
+                        }
+                        policy_type::process_messages(cipher, first, last);
+                    }
+
+                protected:
+                    cipher_type cipher;
+                    block_type chain;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ctr_policy {
+                    typedef std::size_t size_type;
 
-                template<typename Cipher, template<typename> class Padding>
-                struct isomorphic {
                     typedef Cipher cipher_type;
-                    typedef Padding<Cipher> padding_type;
+                    typedef Padding padding_type;
 
-                    typedef detail::isomorphic_encryption_policy<cipher_type, padding_type> encryption_policy;
-                    typedef detail::isomorphic_decryption_policy<cipher_type, padding_type> decryption_policy;
+                    constexpr static const size_type block_bits = cipher_type::block_bits;
+                    constexpr static const size_type block_words = cipher_type::block_words;
+                    typedef typename cipher_type::block_type block_type;
 
-                    template<typename Policy>
-                    struct bind {
-                        typedef detail::isomorphic<Policy> type;
+                    typedef typename cipher_type::endian_type endian_type;
+
+                    constexpr static const size_type value_bits =
+                        sizeof(typename block_type::value_type) * CHAR_BIT;
+
+                    constexpr static const size_type counter_bytes = block_bits / CHAR_BIT;
+                    typedef std::array<std::uint8_t, counter_bytes> counter_type;
+
+                    /*!
+                     * @brief Amount of counter blocks encrypted per cipher invocation. Keeping that
+                     * many independent blocks in flight lets hardware implementations pipeline them;
+                     * sixteen fill the four 512-bit registers the VAES kernel works on.
+                     */
+                    constexpr static const size_type pipeline_blocks = 16;
+                    typedef std::array<block_type, pipeline_blocks> keystream_type;
+
+                    inline static counter_type load_counter(const block_type &iv) {
+                        counter_type counter;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, value_bits, CHAR_BIT>(
+                            iv.begin(), iv.end(), counter.begin());
+                        return counter;
+                    }
+
+                    inline static block_type store_counter(const counter_type &counter) {
+                        block_type block;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, CHAR_BIT, value_bits>(
+                            counter.begin(), counter.end(), block.begin());
+                        return block;
+                    }
+
+                    /*!
+                     * @brief Increments the counter as a single big-endian integer of block_bits width.
+                     */
+                    inline static void increment(counter_type &counter) {
+                        for (size_type i = counter_bytes; i != 0; --i) {
+                            if (++counter[i - 1] != 0) {
+                                break;
+                            }
+                        }
+                    }
+
+                    inline static void generate_keystream(const cipher_type &cipher, counter_type &counter,
+                                                          keystream_type &keystream) {
+                        keystream_type counters;
+                        for (size_type i = 0; i != pipeline_blocks; ++i) {
+                            counters[i] = store_counter(counter);
+                            increment(counter);
+                        }
+                        cipher.encrypt_n(counters.data(), keystream.data(), pipeline_blocks);
+                    }
+
+                    inline static block_type apply_keystream(const block_type &block, const block_type &keystream) {
+                        block_type result;
+                        for (size_type i = 0; i != block.size(); ++i) {
+                            result[i] = block[i] ^ keystream[i];
+                        }
+                        return result;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ctr_encryption_policy : public ctr_policy<Cipher, Padding> { };
+
+                template<typename Cipher, typename Padding>
+                struct ctr_decryption_policy : public ctr_policy<Cipher, Padding> { };
+
+                /*!
+                 * @brief Counter mode. Encryption and decryption are the same operation: the input is
+                 * xored with the encrypted counter sequence, which is generated policy_type::pipeline_blocks
+                 * blocks at a time.
+                 */
+                template<typename Policy>
+                class ctr {
+                    typedef Policy policy_type;
+
+                    typedef typename policy_type::counter_type counter_type;
+                    typedef typename policy_type::keystream_type keystream_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    ctr(const cipher_type &cipher, const block_type &iv = block_type()) :
+                        cipher(cipher), counter(policy_type::load_counter(iv)),
+                        position(policy_type::pipeline_blocks) {
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &plaintext, std::size_t total_seen) {
+                        if (position == policy_type::pipeline_blocks) {
+                            policy_type::generate_keystream(cipher, counter, keystream);
+                            position = 0;
+                        }
+                        return policy_type::apply_keystream(plaintext, keystream[position++]);
+                    }
+
+                    block_type end_message(const block_type &plaintext, std::size_t total_seen) const {
+                        if (position != policy_type::pipeline_blocks) {
+                            return policy_type::apply_keystream(plaintext, keystream[position]);
+                        }
+                        return policy_type::apply_keystream(plaintext,
+                                                            cipher.encrypt(policy_type::store_counter(counter)));
+                    }
+
+                protected:
+                    cipher_type cipher;
+                    counter_type counter;
+                    keystream_type keystream;
+                    size_type position;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_policy {
+                    typedef std::size_t size_type;
+
+                    typedef Cipher cipher_type;
+                    typedef Padding padding_type;
+
+                    constexpr static const size_type block_bits = cipher_type::block_bits;
+                    constexpr static const size_type block_words = cipher_type::block_words;
+                    typedef typename cipher_type::block_type block_type;
+
+                    typedef typename cipher_type::endian_type endian_type;
+
+                    constexpr static const size_type value_bits =
+                        sizeof(typename block_type::value_type) * CHAR_BIT;
+
+                    constexpr static const size_type block_bytes = block_bits / CHAR_BIT;
+                    typedef std::array<std::uint8_t, block_bytes> bytes_type;
+
+                    constexpr static const size_type tag_bits = 128;
+                    typedef std::array<std::uint8_t, tag_bits / CHAR_BIT> tag_type;
+
+                    /*!
+                     * @brief Amount of counter blocks encrypted per cipher invocation, as in ctr.
+                     */
+                    constexpr static const size_type pipeline_blocks = 16;
+                    typedef std::array<block_type, pipeline_blocks> keystream_type;
+
+                    /*!
+                     * @brief Amount of ciphertext blocks buffered before they are hashed, which matches
+                     * the aggregation width of the carry-less multiplication GHASH.
+                     */
+                    constexpr static const size_type hash_blocks = 8;
+
+                    inline static bytes_type to_bytes(const block_type &block) {
+                        bytes_type bytes;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, value_bits, CHAR_BIT>(
+                            block.begin(), block.end(), bytes.begin());
+                        return bytes;
+                    }
+
+                    inline static block_type from_bytes(const bytes_type &bytes) {
+                        block_type block;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, CHAR_BIT, value_bits>(
+                            bytes.begin(), bytes.end(), block.begin());
+                        return block;
+                    }
+
+                    /*!
+                     * @brief Increments the low 32 bits of the counter block, big-endian.
+                     */
+                    inline static void increment(bytes_type &counter) {
+                        for (size_type i = block_bytes; i != block_bytes - 4; --i) {
+                            if (++counter[i - 1] != 0) {
+                                break;
+                            }
+                        }
+                    }
+
+                    inline static void generate_keystream(const cipher_type &cipher, bytes_type &counter,
+                                                          keystream_type &keystream) {
+                        keystream_type counters;
+                        for (size_type i = 0; i != pipeline_blocks; ++i) {
+                            counters[i] = from_bytes(counter);
+                            increment(counter);
+                        }
+                        cipher.encrypt_n(counters.data(), keystream.data(), pipeline_blocks);
+                    }
+
+                    inline static block_type apply_keystream(const block_type &block, const block_type &keystream) {
+                        block_type result;
+                        for (size_type i = 0; i != block.size(); ++i) {
+                            result[i] = block[i] ^ keystream[i];
+                        }
+                        return result;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_encryption_policy : public gcm_policy<Cipher, Padding> {
+                    typedef typename gcm_policy<Cipher, Padding>::block_type block_type;
+                    typedef typename gcm_policy<Cipher, Padding>::tag_type tag_type;
+
+                    inline static const block_type &ciphertext(const block_type &, const block_type &output) {
+                        return output;
+                    }
+
+                    /*!
+                     * @brief Appends the tag to the output. Always succeeds.
+                     */
+                    template<typename OutputContainer>
+                    inline static bool finish_tag(const tag_type &tag, const tag_type &, OutputContainer &output) {
+                        output.insert(output.end(), tag.begin(), tag.end());
+                        return true;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_decryption_policy : public gcm_policy<Cipher, Padding> {
+                    typedef typename gcm_policy<Cipher, Padding>::block_type block_type;
+                    typedef typename gcm_policy<Cipher, Padding>::tag_type tag_type;
+
+                    inline static const block_type &ciphertext(const block_type &input, const block_type &) {
+                        return input;
+                    }
+
+                    /*!
+                     * @brief Compares the tag with the received one in constant time. On mismatch the
+                     * decrypted output is wiped.
+                     */
+                    template<typename OutputContainer>
+                    inline static bool finish_tag(const tag_type &tag, const tag_type &received,
+                                                  OutputContainer &output) {
+                        if (!constant_time_compare(tag.data(), received.data(), tag.size())) {
+                            std::fill(output.begin(), output.end(), 0);
+                            output.clear();
+                            return false;
+                        }
+                        return true;
+                    }
+                };
+
+                /*!
+                 * @brief Galois/Counter Mode (NIST SP 800-38D). The message is encrypted in counter mode
+                 * and the ciphertext is authenticated with GHASH in the same pass: counter blocks are
+                 * encrypted policy_type::pipeline_blocks at a time and ciphertext is hashed
+                 * policy_type::hash_blocks at a time, both while the data is still in cache.
+                 *
+                 * On encryption the output is the ciphertext followed by the tag. On decryption the
+                 * received tag is passed to the constructor and the output is the plaintext only; it is
+                 * released by finish_message once the tag has been checked, and wiped otherwise.
+                 */
+                template<typename Policy>
+                class gcm {
+                    typedef Policy policy_type;
+
+                    typedef typename policy_type::bytes_type bytes_type;
+                    typedef typename policy_type::keystream_type keystream_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const size_type tag_bits = policy_type::tag_bits;
+                    typedef typename policy_type::tag_type tag_type;
+
+                    BOOST_STATIC_ASSERT_MSG(block_bits == 128, "GCM is defined for 128-bit block ciphers only");
+
+                    template<typename IvRange>
+                    gcm(const cipher_type &cipher, const IvRange &iv) : gcm(cipher, iv, std::vector<std::uint8_t>()) {
+                    }
+
+                    template<typename IvRange, typename AadRange>
+                    gcm(const cipher_type &cipher, const IvRange &iv, const AadRange &aad) :
+                        cipher(cipher), hash(policy_type::to_bytes(cipher.encrypt(block_type()))),
+                        position(policy_type::pipeline_blocks), pending(0), aad_bits(0), received_tag() {
+                        const std::vector<std::uint8_t> iv_bytes(std::begin(iv), std::end(iv));
+                        const std::vector<std::uint8_t> aad_bytes(std::begin(aad), std::end(aad));
+
+                        if (iv_bytes.size() == 12) {
+                            counter.fill(0);
+                            std::copy(iv_bytes.begin(), iv_bytes.end(), counter.begin());
+                            counter[policy_type::block_bytes - 1] = 1;
+                        } else {
+                            ghash_type iv_hash(hash);
+                            iv_hash.update_padded(iv_bytes.data(), iv_bytes.size());
+                            iv_hash.update_lengths(0, iv_bytes.size() * CHAR_BIT);
+                            counter = iv_hash.digest();
+                        }
+
+                        tag_mask = policy_type::to_bytes(cipher.encrypt(policy_type::from_bytes(counter)));
+                        policy_type::increment(counter);
+
+                        hash.update_padded(aad_bytes.data(), aad_bytes.size());
+                        aad_bits = aad_bytes.size() * CHAR_BIT;
+                    }
+
+                    /*!
+                     * @param tag Tag received with the message, checked by finish_message on decryption.
+                     * A decrypting instance constructed without one fails to authenticate any message.
+                     * @throws std::invalid_argument if the tag is not tag_bits long.
+                     */
+                    template<typename IvRange, typename AadRange, typename TagRange>
+                    gcm(const cipher_type &cipher, const IvRange &iv, const AadRange &aad, const TagRange &tag) :
+                        gcm(cipher, iv, aad) {
+                        const std::vector<std::uint8_t> tag_bytes(std::begin(tag), std::end(tag));
+                        if (tag_bytes.size() != received_tag.size()) {
+                            throw std::invalid_argument("gcm tag has to be 16 bytes long");
+                        }
+                        std::copy(tag_bytes.begin(), tag_bytes.end(), received_tag.begin());
+                    }
+
+                    ~gcm() {
+                        tag_mask.fill(0);
+                        buffer.fill(0);
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &input, std::size_t total_seen) {
+                        if (position == policy_type::pipeline_blocks) {
+                            policy_type::generate_keystream(cipher, counter, keystream);
+                            position = 0;
+                        }
+
+                        const block_type output = policy_type::apply_keystream(input, keystream[position++]);
+
+                        const bytes_type ciphertext = policy_type::to_bytes(policy_type::ciphertext(input, output));
+                        std::copy(ciphertext.begin(), ciphertext.end(),
+                                  buffer.begin() + pending * policy_type::block_bytes);
+                        if (++pending == policy_type::hash_blocks) {
+                            hash.update(buffer.data(), pending);
+                            pending = 0;
+                        }
+
+                        return output;
+                    }
+
+                    block_type end_message(const block_type &input, std::size_t total_seen) const {
+                        if (position != policy_type::pipeline_blocks) {
+                            return policy_type::apply_keystream(input, keystream[position]);
+                        }
+                        return policy_type::apply_keystream(input, cipher.encrypt(policy_type::from_bytes(counter)));
+                    }
+
+                    /*!
+                     * @brief Authenticates the message. The last block of the message is passed in as it
+                     * was handed to end_message, together with the message length in bits, and output
+                     * holds the processed message. On encryption the tag is appended to output, on
+                     * decryption it is compared with the received one in constant time.
+                     * @return false if decryption failed to authenticate, in which case output is wiped.
+                     */
+                    template<typename OutputContainer>
+                    bool finish_message(const block_type &input, std::size_t total_seen,
+                                        OutputContainer &output) const {
+                        tag_type result_tag = tag(input, total_seen);
+                        const bool result = policy_type::finish_tag(result_tag, received_tag, output);
+                        result_tag.fill(0);
+                        return result;
+                    }
+
+                protected:
+                    typedef ghash ghash_type;
+
+                    tag_type tag(const block_type &input, std::size_t total_seen) const {
+                        ghash_type final_hash(hash);
+                        final_hash.update(buffer.data(), pending);
+
+                        if (total_seen != 0) {
+                            const size_type last_bits = total_seen % block_bits ? total_seen % block_bits : block_bits;
+                            const bytes_type ciphertext = policy_type::to_bytes(
+                                policy_type::ciphertext(input, end_message(input, total_seen)));
+                            final_hash.update_padded(ciphertext.data(), last_bits / CHAR_BIT);
+                        }
+
+                        final_hash.update_lengths(aad_bits, total_seen);
+
+                        tag_type result;
+                        for (size_type i = 0; i != result.size(); ++i) {
+                            result[i] = final_hash.digest()[i] ^ tag_mask[i];
+                        }
+                        return result;
+                    }
+
+                    cipher_type cipher;
+                    ghash_type hash;
+                    bytes_type counter;
+                    bytes_type tag_mask;
+                    keystream_type keystream;
+                    size_type position;
+
+                    std::array<std::uint8_t, policy_type::hash_blocks * policy_type::block_bytes> buffer;
+                    size_type pending;
+                    std::uint64_t aad_bits;
+                    tag_type received_tag;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_siv_policy {
+                    typedef std::size_t size_type;
+
+                    typedef Cipher cipher_type;
+                    typedef Padding padding_type;
+
+                    constexpr static const size_type block_bits = cipher_type::block_bits;
+                    constexpr static const size_type block_words = cipher_type::block_words;
+                    typedef typename cipher_type::block_type block_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename cipher_type::endian_type endian_type;
+
+                    constexpr static const size_type value_bits =
+                        sizeof(typename block_type::value_type) * CHAR_BIT;
+
+                    constexpr static const size_type block_bytes = block_bits / CHAR_BIT;
+                    typedef std::array<std::uint8_t, block_bytes> bytes_type;
+
+                    constexpr static const size_type nonce_bytes = 12;
+                    typedef std::array<std::uint8_t, nonce_bytes> nonce_type;
+
+                    constexpr static const size_type tag_bits = 128;
+                    typedef std::array<std::uint8_t, tag_bits / CHAR_BIT> tag_type;
+
+                    /*!
+                     * @brief Largest plaintext and associated data length, in bytes, RFC 8452 allows.
+                     */
+                    constexpr static const std::uint64_t max_message_bytes = std::uint64_t(1) << 36;
+
+                    /*!
+                     * @brief Amount of counter blocks encrypted per cipher invocation, as in ocb.
+                     */
+                    constexpr static const size_type pipeline_blocks = 64;
+
+                    /*!
+                     * @brief Amount of nonces whose derived keys are kept by the mode. Deriving them
+                     * costs four or six block encryptions and a key schedule, which otherwise dominates
+                     * short messages.
+                     */
+                    constexpr static const size_type cached_nonces = 8;
+
+                    /*!
+                     * @brief Blocks of key material derived per nonce: two for the POLYVAL key and two
+                     * (AES-128) or four (AES-256) for the message encryption key, of which the first half
+                     * of each is used.
+                     */
+                    constexpr static const size_type derivation_blocks = 2 + cipher_type::key_bits / 64;
+
+                    inline static bytes_type to_bytes(const block_type &block) {
+                        bytes_type bytes;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, value_bits, CHAR_BIT>(
+                            block.begin(), block.end(), bytes.begin());
+                        return bytes;
+                    }
+
+                    inline static block_type from_bytes(const bytes_type &bytes) {
+                        block_type block;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, CHAR_BIT, value_bits>(
+                            bytes.begin(), bytes.end(), block.begin());
+                        return block;
+                    }
+
+                    /*!
+                     * @brief Derives the POLYVAL key and the message encryption key for a nonce with a
+                     * single call to encrypt_n.
+                     */
+                    inline static void derive_keys(const cipher_type &cipher, const nonce_type &nonce,
+                                                   bytes_type &hash_key, key_type &encryption_key) {
+                        std::array<block_type, derivation_blocks> blocks;
+                        for (size_type i = 0; i != derivation_blocks; ++i) {
+                            bytes_type input = {static_cast<std::uint8_t>(i)};
+                            std::copy(nonce.begin(), nonce.end(), input.begin() + 4);
+                            blocks[i] = from_bytes(input);
+                        }
+
+                        cipher.encrypt_n(blocks.data(), blocks.data(), derivation_blocks);
+
+                        for (size_type i = 0; i != derivation_blocks; ++i) {
+                            const bytes_type output = to_bytes(blocks[i]);
+                            if (i < 2) {
+                                std::copy(output.begin(), output.begin() + 8, hash_key.begin() + 8 * i);
+                            } else {
+                                std::copy(output.begin(), output.begin() + 8, encryption_key.begin() + 8 * (i - 2));
+                            }
+                        }
+
+                        blocks.fill(block_type());
+                    }
+
+                    /*!
+                     * @brief Encrypts the counter blocks derived from the tag and xors them into data, in
+                     * place. The counter is the low 32 bits of the block, little-endian.
+                     */
+                    inline static void apply_keystream(const cipher_type &cipher, const tag_type &tag,
+                                                       std::uint8_t *data, size_type bytes) {
+                        bytes_type counter = tag;
+                        counter[block_bytes - 1] |= 0x80;
+                        std::uint32_t count = counter[0] | (std::uint32_t(counter[1]) << 8) |
+                                              (std::uint32_t(counter[2]) << 16) | (std::uint32_t(counter[3]) << 24);
+
+                        std::array<block_type, pipeline_blocks> counters;
+                        while (bytes != 0) {
+                            const size_type n = std::min(pipeline_blocks, (bytes + block_bytes - 1) / block_bytes);
+
+                            for (size_type i = 0; i != n; ++i, ++count) {
+                                for (size_type j = 0; j != 4; ++j) {
+                                    counter[j] = static_cast<std::uint8_t>(count >> (8 * j));
+                                }
+                                counters[i] = from_bytes(counter);
+                            }
+
+                            cipher.encrypt_n(counters.data(), counters.data(), n);
+
+                            for (size_type i = 0; i != n; ++i) {
+                                const bytes_type keystream = to_bytes(counters[i]);
+                                const size_type chunk = std::min(block_bytes, bytes);
+                                for (size_type j = 0; j != chunk; ++j) {
+                                    data[j] ^= keystream[j];
+                                }
+                                data += chunk;
+                                bytes -= chunk;
+                            }
+                        }
+
+                        counters.fill(block_type());
+                    }
+
+                    /*!
+                     * @brief Computes the tag over the associated data and the plaintext. hash is a
+                     * fresh POLYVAL instance keyed for the nonce.
+                     */
+                    inline static tag_type compute_tag(const cipher_type &cipher, polyval hash, const nonce_type &nonce,
+                                                       const std::uint8_t *aad, size_type aad_bytes,
+                                                       const std::uint8_t *plaintext, size_type bytes) {
+                        hash.update_padded(aad, aad_bytes);
+                        hash.update_padded(plaintext, bytes);
+                        hash.update_lengths(std::uint64_t(aad_bytes) * CHAR_BIT, std::uint64_t(bytes) * CHAR_BIT);
+
+                        bytes_type s = hash.digest();
+                        for (size_type i = 0; i != nonce_bytes; ++i) {
+                            s[i] ^= nonce[i];
+                        }
+                        s[block_bytes - 1] &= 0x7f;
+
+                        return to_bytes(cipher.encrypt(from_bytes(s)));
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_siv_encryption_policy : public gcm_siv_policy<Cipher, Padding> {
+                    typedef gcm_siv_policy<Cipher, Padding> policy_type;
+
+                    typedef typename policy_type::size_type size_type;
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::nonce_type nonce_type;
+                    typedef typename policy_type::tag_type tag_type;
+
+                    /*!
+                     * @brief Encrypts data in place and stores the tag. Always succeeds.
+                     */
+                    inline static bool process_message(const cipher_type &cipher, const polyval &hash,
+                                                       const nonce_type &nonce, const std::uint8_t *aad,
+                                                       size_type aad_bytes, std::uint8_t *data, size_type bytes,
+                                                       tag_type &tag) {
+                        tag = policy_type::compute_tag(cipher, hash, nonce, aad, aad_bytes, data, bytes);
+                        policy_type::apply_keystream(cipher, tag, data, bytes);
+                        return true;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct gcm_siv_decryption_policy : public gcm_siv_policy<Cipher, Padding> {
+                    typedef gcm_siv_policy<Cipher, Padding> policy_type;
+
+                    typedef typename policy_type::size_type size_type;
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::nonce_type nonce_type;
+                    typedef typename policy_type::tag_type tag_type;
+
+                    /*!
+                     * @brief Decrypts data in place and checks it against the received tag in constant
+                     * time. On mismatch the decrypted data is wiped and false is returned.
+                     */
+                    inline static bool process_message(const cipher_type &cipher, const polyval &hash,
+                                                       const nonce_type &nonce, const std::uint8_t *aad,
+                                                       size_type aad_bytes, std::uint8_t *data, size_type bytes,
+                                                       tag_type &tag) {
+                        policy_type::apply_keystream(cipher, tag, data, bytes);
+                        const tag_type expected =
+                            policy_type::compute_tag(cipher, hash, nonce, aad, aad_bytes, data, bytes);
+
+                        if (!constant_time_compare(expected.data(), tag.data(), tag.size())) {
+                            std::fill(data, data + bytes, 0);
+                            return false;
+                        }
+                        return true;
+                    }
+                };
+
+                /*!
+                 * @brief AES-GCM-SIV (RFC 8452), nonce misuse-resistant authenticated encryption. The
+                 * tag is computed with POLYVAL over the whole plaintext and then serves as the initial
+                 * counter block, so equal messages under an equal nonce give equal ciphertexts and a
+                 * repeated nonce reveals nothing beyond that.
+                 *
+                 * As encryption cannot start before the whole plaintext has been hashed, the mode is
+                 * not usable through the block pipeline; messages are processed in place by
+                 * process_message or process_messages. The keys derived for the most recent
+                 * policy_type::cached_nonces nonces are kept, so batches of messages under the same
+                 * nonce, as in deduplicating storage, derive them once. The cache makes instances
+                 * unsafe to share between threads.
+                 */
+                template<typename Policy>
+                class gcm_siv {
+                    typedef Policy policy_type;
+
+                    typedef typename policy_type::bytes_type bytes_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    typedef typename policy_type::nonce_type nonce_type;
+                    typedef typename policy_type::tag_type tag_type;
+
+                    struct message_type {
+                        nonce_type nonce;
+                        std::vector<std::uint8_t> aad;
+                        std::vector<std::uint8_t> data;
+                        tag_type tag;
+                    };
+
+                    BOOST_STATIC_ASSERT_MSG(block_bits == 128, "GCM-SIV is defined for 128-bit block ciphers only");
+                    BOOST_STATIC_ASSERT_MSG(cipher_type::key_bits == 128 || cipher_type::key_bits == 256,
+                                            "GCM-SIV is defined for 128 and 256-bit keys only");
+
+                    /*!
+                     * @param cipher Cipher keyed with the key-generating key.
+                     */
+                    gcm_siv(const cipher_type &cipher) : cipher(cipher), next(0) {
+                        derived.reserve(policy_type::cached_nonces);
+                    }
+
+                    /*!
+                     * @brief Processes one message in place. On encryption tag receives the tag, on
+                     * decryption it holds the received one.
+                     * @return false if decryption failed to authenticate, in which case data is zeroed.
+                     * @throws std::invalid_argument if the message or associated data exceed 2^36 bytes.
+                     */
+                    bool process_message(const nonce_type &nonce, const std::uint8_t *aad, std::size_t aad_bytes,
+                                         std::uint8_t *data, std::size_t bytes, tag_type &tag) {
+                        if (bytes > policy_type::max_message_bytes || aad_bytes > policy_type::max_message_bytes) {
+                            throw std::invalid_argument("gcm_siv message or associated data is too long");
+                        }
+
+                        const derived_keys &keys = derive(nonce);
+                        return policy_type::process_message(keys.cipher, keys.hash, nonce, aad, aad_bytes, data,
+                                                            bytes, tag);
+                    }
+
+                    /*!
+                     * @brief Processes a batch of message_type elements in place.
+                     * @return Amount of messages which failed to authenticate.
+                     */
+                    template<typename InputIterator>
+                    size_type process_messages(InputIterator first, InputIterator last) {
+                        size_type failed = 0;
+                        for (; first != last; ++first) {
+                            if (!process_message(first->nonce, first->aad.data(), first->aad.size(),
+                                                 first->data.data(), first->data.size(), first->tag)) {
+                                ++failed;
+                            }
+                        }
+                        return failed;
+                    }
+
+                protected:
+                    struct derived_keys {
+                        nonce_type nonce;
+                        cipher_type cipher;
+                        polyval hash;
+                    };
+
+                    const derived_keys &derive(const nonce_type &nonce) {
+                        for (const derived_keys &keys : derived) {
+                            if (keys.nonce == nonce) {
+                                return keys;
+                            }
+                        }
+
+                        bytes_type hash_key;
+                        key_type encryption_key;
+                        policy_type::derive_keys(cipher, nonce, hash_key, encryption_key);
+
+                        derived_keys keys = {nonce, cipher_type(encryption_key), polyval(hash_key)};
+                        hash_key.fill(0);
+                        encryption_key.fill(0);
+
+                        if (derived.size() < policy_type::cached_nonces) {
+                            derived.push_back(keys);
+                            return derived.back();
+                        }
+
+                        derived[next] = keys;
+                        const derived_keys &result = derived[next];
+                        next = (next + 1) % policy_type::cached_nonces;
+                        return result;
+                    }
+
+                    cipher_type cipher;
+                    std::vector<derived_keys> derived;
+                    size_type next;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ccm_policy {
+                    typedef std::size_t size_type;
+
+                    typedef Cipher cipher_type;
+                    typedef Padding padding_type;
+
+                    constexpr static const size_type block_bits = cipher_type::block_bits;
+                    constexpr static const size_type block_words = cipher_type::block_words;
+                    typedef typename cipher_type::block_type block_type;
+
+                    typedef typename cipher_type::endian_type endian_type;
+
+                    constexpr static const size_type value_bits =
+                        sizeof(typename block_type::value_type) * CHAR_BIT;
+
+                    constexpr static const size_type block_bytes = block_bits / CHAR_BIT;
+                    typedef std::array<std::uint8_t, block_bytes> bytes_type;
+
+                    constexpr static const size_type min_nonce_bytes = 7;
+                    constexpr static const size_type max_nonce_bytes = 13;
+
+                    inline static bytes_type to_bytes(const block_type &block) {
+                        bytes_type bytes;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, value_bits, CHAR_BIT>(
+                            block.begin(), block.end(), bytes.begin());
+                        return bytes;
+                    }
+
+                    inline static block_type from_bytes(const bytes_type &bytes) {
+                        block_type block;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, CHAR_BIT, value_bits>(
+                            bytes.begin(), bytes.end(), block.begin());
+                        return block;
+                    }
+
+                    /*!
+                     * @brief The CBC-MAC state stays in the cipher's block representation, so that the
+                     * chain does not go through packing between invocations.
+                     */
+                    inline static block_type xor_block(const block_type &a, const block_type &b) {
+                        block_type result;
+                        for (size_type i = 0; i != a.size(); ++i) {
+                            result[i] = a[i] ^ b[i];
+                        }
+                        return result;
+                    }
+
+                    /*!
+                     * @brief Stores value big-endian in the last length bytes of block.
+                     */
+                    inline static void store_length(bytes_type &block, size_type length, std::uint64_t value) {
+                        for (size_type i = 0; i != length; ++i) {
+                            block[block_bytes - 1 - i] = static_cast<std::uint8_t>(value >> (8 * i));
+                        }
+                    }
+
+                    /*!
+                     * @brief Encodes the associated data with its length prefix and zero-pads it to whole
+                     * blocks, as in SP 800-38C, A.2.2.
+                     */
+                    inline static std::vector<std::uint8_t> format_aad(const std::uint8_t *aad, size_type aad_bytes) {
+                        std::vector<std::uint8_t> header;
+                        if (aad_bytes == 0) {
+                            return header;
+                        }
+
+                        const std::uint64_t length = aad_bytes;
+                        size_type length_bytes = 2;
+                        if (length >= 0xff00 && length <= 0xffffffff) {
+                            header = {0xff, 0xfe};
+                            length_bytes = 4;
+                        } else if (length > 0xffffffff) {
+                            header = {0xff, 0xff};
+                            length_bytes = 8;
+                        }
+                        for (size_type i = length_bytes; i != 0; --i) {
+                            header.push_back(static_cast<std::uint8_t>(length >> (8 * (i - 1))));
+                        }
+
+                        header.insert(header.end(), aad, aad + aad_bytes);
+                        header.resize((header.size() + block_bytes - 1) / block_bytes * block_bytes, 0);
+                        return header;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ccm_encryption_policy : public ccm_policy<Cipher, Padding> {
+                    typedef ccm_policy<Cipher, Padding> policy_type;
+
+                    typedef typename policy_type::size_type size_type;
+                    typedef typename policy_type::bytes_type bytes_type;
+
+                    /*!
+                     * @brief Encrypts up to one block in place and returns the zero-padded plaintext for
+                     * the CBC-MAC.
+                     */
+                    inline static bytes_type process_payload(std::uint8_t *data, size_type bytes,
+                                                             const bytes_type &keystream) {
+                        bytes_type plaintext = {0};
+                        for (size_type i = 0; i != bytes; ++i) {
+                            plaintext[i] = data[i];
+                            data[i] ^= keystream[i];
+                        }
+                        return plaintext;
+                    }
+
+                    inline static bool finish(const bytes_type &mac, std::uint8_t *tag, size_type tag_bytes,
+                                              std::uint8_t *, size_type) {
+                        std::copy(mac.begin(), mac.begin() + tag_bytes, tag);
+                        return true;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ccm_decryption_policy : public ccm_policy<Cipher, Padding> {
+                    typedef ccm_policy<Cipher, Padding> policy_type;
+
+                    typedef typename policy_type::size_type size_type;
+                    typedef typename policy_type::bytes_type bytes_type;
+
+                    inline static bytes_type process_payload(std::uint8_t *data, size_type bytes,
+                                                             const bytes_type &keystream) {
+                        bytes_type plaintext = {0};
+                        for (size_type i = 0; i != bytes; ++i) {
+                            data[i] ^= keystream[i];
+                            plaintext[i] = data[i];
+                        }
+                        return plaintext;
+                    }
+
+                    /*!
+                     * @brief Compares the received tag in constant time. On mismatch the decrypted data
+                     * is wiped.
+                     */
+                    inline static bool finish(const bytes_type &mac, std::uint8_t *tag, size_type tag_bytes,
+                                              std::uint8_t *data, size_type bytes) {
+                        if (!constant_time_compare(mac.data(), tag, tag_bytes)) {
+                            std::fill(data, data + bytes, 0);
+                            return false;
+                        }
+                        return true;
+                    }
+                };
+
+                /*!
+                 * @brief Counter with CBC-MAC (NIST SP 800-38C, RFC 3610). The CBC-MAC over the
+                 * formatted header and the plaintext is a serial chain, so instead of a MAC pass
+                 * followed by a counter mode pass each cipher invocation carries the next MAC block
+                 * together with the counter block needed one step later. The counter work then runs in
+                 * the latency shadow of the MAC chain and the message is read only once.
+                 *
+                 * The message length is part of the first MAC block, so the mode is not usable through
+                 * the block pipeline; messages are processed in place by process_message.
+                 */
+                template<typename Policy>
+                class ccm {
+                    typedef Policy policy_type;
+
+                    typedef typename policy_type::bytes_type bytes_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    BOOST_STATIC_ASSERT_MSG(block_bits == 128, "CCM is defined for 128-bit block ciphers only");
+
+                    /*!
+                     * @throws std::invalid_argument if tag_bytes is not one of 4, 6, ..., 16.
+                     */
+                    ccm(const cipher_type &cipher, std::size_t tag_bytes = 16) : cipher(cipher), tag_bytes(tag_bytes) {
+                        if (tag_bytes < 4 || tag_bytes > 16 || tag_bytes % 2 != 0) {
+                            throw std::invalid_argument("ccm tag length has to be an even number from 4 to 16");
+                        }
+                    }
+
+                    size_type tag_size() const {
+                        return tag_bytes;
+                    }
+
+                    /*!
+                     * @brief Processes one message in place. On encryption tag receives tag_size() bytes
+                     * of tag, on decryption it holds the received one.
+                     * @return false if decryption failed to authenticate, in which case data is zeroed.
+                     * @throws std::invalid_argument if the nonce is not 7 to 13 bytes long or the message
+                     * length does not fit the 15 - nonce length bytes left for it.
+                     */
+                    template<typename NonceRange>
+                    bool process_message(const NonceRange &nonce, const std::uint8_t *aad, std::size_t aad_bytes,
+                                         std::uint8_t *data, std::size_t bytes, std::uint8_t *tag) const {
+                        const std::vector<std::uint8_t> nonce_bytes(std::begin(nonce), std::end(nonce));
+                        if (nonce_bytes.size() < policy_type::min_nonce_bytes ||
+                            nonce_bytes.size() > policy_type::max_nonce_bytes) {
+                            throw std::invalid_argument("ccm nonce has to be 7 to 13 bytes long");
+                        }
+
+                        const size_type length_bytes = policy_type::block_bytes - 1 - nonce_bytes.size();
+                        if (length_bytes < 8 && (std::uint64_t(bytes) >> (8 * length_bytes)) != 0) {
+                            throw std::invalid_argument("ccm message is too long for the nonce length");
+                        }
+
+                        bytes_type first = {static_cast<std::uint8_t>((aad_bytes ? 0x40 : 0) |
+                                                                      ((tag_bytes - 2) / 2) << 3 | (length_bytes - 1))};
+                        std::copy(nonce_bytes.begin(), nonce_bytes.end(), first.begin() + 1);
+                        policy_type::store_length(first, length_bytes, bytes);
+
+                        bytes_type counter = {static_cast<std::uint8_t>(length_bytes - 1)};
+                        std::copy(nonce_bytes.begin(), nonce_bytes.end(), counter.begin() + 1);
+
+                        const std::vector<std::uint8_t> header = policy_type::format_aad(aad, aad_bytes);
+
+                        const size_type header_blocks = header.size() / policy_type::block_bytes;
+                        const size_type payload_blocks =
+                            (bytes + policy_type::block_bytes - 1) / policy_type::block_bytes;
+
+                        // step s feeds MAC block s and encrypts the counter block consumed at step s + 1
+                        std::array<block_type, 3> blocks;
+                        block_type mac = policy_type::from_bytes(first);
+                        bytes_type keystream, mask;
+                        for (size_type s = 0; s != 1 + header_blocks + payload_blocks; ++s) {
+                            size_type n = 0;
+                            if (s == 0) {
+                                blocks[n++] = mac;
+                            } else {
+                                bytes_type input;
+                                if (s <= header_blocks) {
+                                    std::copy(header.begin() + (s - 1) * policy_type::block_bytes,
+                                              header.begin() + s * policy_type::block_bytes, input.begin());
+                                } else {
+                                    const size_type offset = (s - header_blocks - 1) * policy_type::block_bytes;
+                                    input = policy_type::process_payload(
+                                        data + offset, std::min(policy_type::block_bytes, bytes - offset), keystream);
+                                }
+                                blocks[n++] = policy_type::xor_block(mac, policy_type::from_bytes(input));
+                            }
+
+                            const bool next_counter = s >= header_blocks && s - header_blocks < payload_blocks;
+
+                            if (s == 0) {
+                                blocks[n++] = policy_type::from_bytes(counter);
+                            }
+                            if (next_counter) {
+                                policy_type::store_length(counter, length_bytes, s - header_blocks + 1);
+                                blocks[n++] = policy_type::from_bytes(counter);
+                            }
+
+                            cipher.encrypt_n(blocks.data(), blocks.data(), n);
+
+                            mac = blocks[0];
+                            if (s == 0) {
+                                mask = policy_type::to_bytes(blocks[1]);
+                            }
+                            if (next_counter) {
+                                keystream = policy_type::to_bytes(blocks[n - 1]);
+                            }
+                        }
+
+                        bytes_type result_tag = policy_type::to_bytes(mac);
+                        for (size_type i = 0; i != tag_bytes; ++i) {
+                            result_tag[i] ^= mask[i];
+                        }
+
+                        const bool result = policy_type::finish(result_tag, tag, tag_bytes, data, bytes);
+
+                        result_tag.fill(0);
+                        mac.fill(0);
+                        keystream.fill(0);
+                        mask.fill(0);
+                        blocks.fill(block_type());
+
+                        return result;
+                    }
+
+                protected:
+                    cipher_type cipher;
+                    size_type tag_bytes;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ocb_policy {
+                    typedef std::size_t size_type;
+
+                    typedef Cipher cipher_type;
+                    typedef Padding padding_type;
+
+                    constexpr static const size_type block_bits = cipher_type::block_bits;
+                    constexpr static const size_type block_words = cipher_type::block_words;
+                    typedef typename cipher_type::block_type block_type;
+
+                    typedef typename cipher_type::endian_type endian_type;
+
+                    constexpr static const size_type value_bits =
+                        sizeof(typename block_type::value_type) * CHAR_BIT;
+
+                    constexpr static const size_type block_bytes = block_bits / CHAR_BIT;
+                    typedef std::array<std::uint8_t, block_bytes> bytes_type;
+
+                    constexpr static const size_type tag_bits = 128;
+                    typedef std::array<std::uint8_t, tag_bits / CHAR_BIT> tag_type;
+
+                    /*!
+                     * @brief Amount of blocks passed to the cipher at once by process_n. Larger batches
+                     * amortize the call and keep wide VAES implementations in their main loop.
+                     */
+                    constexpr static const size_type pipeline_blocks = 64;
+
+                    /*!
+                     * @brief Amount of precomputed L_i values, enough for any block index that fits
+                     * a size_type.
+                     */
+                    constexpr static const size_type offset_table_size = sizeof(size_type) * CHAR_BIT;
+
+                    inline static bytes_type to_bytes(const block_type &block) {
+                        bytes_type bytes;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, value_bits, CHAR_BIT>(
+                            block.begin(), block.end(), bytes.begin());
+                        return bytes;
+                    }
+
+                    inline static block_type from_bytes(const bytes_type &bytes) {
+                        block_type block;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, CHAR_BIT, value_bits>(
+                            bytes.begin(), bytes.end(), block.begin());
+                        return block;
+                    }
+
+                    inline static bytes_type xor_bytes(const bytes_type &a, const bytes_type &b) {
+                        bytes_type result;
+                        for (size_type i = 0; i != block_bytes; ++i) {
+                            result[i] = a[i] ^ b[i];
+                        }
+                        return result;
+                    }
+
+                    /*!
+                     * @brief Packing only moves bits around, so offsets and the checksum can be kept and
+                     * xored in the cipher's own block representation.
+                     */
+                    inline static block_type xor_block(const block_type &a, const block_type &b) {
+                        block_type result;
+                        for (size_type i = 0; i != a.size(); ++i) {
+                            result[i] = a[i] ^ b[i];
+                        }
+                        return result;
+                    }
+
+                    /*!
+                     * @brief Multiplies by x in GF(2^128), big-endian bit order.
+                     */
+                    inline static bytes_type double_block(const bytes_type &x) {
+                        bytes_type result;
+                        for (size_type i = 0; i != block_bytes - 1; ++i) {
+                            result[i] = static_cast<std::uint8_t>((x[i] << 1) | (x[i + 1] >> 7));
+                        }
+                        result[block_bytes - 1] = static_cast<std::uint8_t>((x[block_bytes - 1] << 1) ^
+                                                                            ((0 - (x[0] >> 7)) & 0x87));
+                        return result;
+                    }
+
+                    /*!
+                     * @brief Number of trailing zeros of a nonzero block index, found branch-free with a
+                     * de Bruijn sequence. A bit loop here mispredicts often enough to dominate process_n.
+                     */
+                    inline static size_type ntz(std::uint64_t i) {
+                        static const std::uint8_t positions[64] = {
+                            0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,  62, 55, 59, 36, 53, 51,
+                            43, 22, 45, 39, 33, 30, 24, 18, 12, 5,  63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21,
+                            44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+                        return positions[((i & (0 - i)) * 0x03f79d71b4cb0a89ULL) >> 58];
+                    }
+
+                    inline static bytes_type encrypt(const cipher_type &cipher, const bytes_type &block) {
+                        return to_bytes(cipher.encrypt(from_bytes(block)));
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ocb_encryption_policy : public ocb_policy<Cipher, Padding> {
+                    typedef typename ocb_policy<Cipher, Padding>::cipher_type cipher_type;
+                    typedef typename ocb_policy<Cipher, Padding>::block_type block_type;
+                    typedef typename ocb_policy<Cipher, Padding>::bytes_type bytes_type;
+                    typedef typename ocb_policy<Cipher, Padding>::tag_type tag_type;
+
+                    inline static void process_n(const cipher_type &cipher, const block_type *plaintext,
+                                                 block_type *ciphertext, std::size_t n) {
+                        cipher.encrypt_n(plaintext, ciphertext, n);
+                    }
+
+                    template<typename T>
+                    inline static const T &plaintext(const T &input, const T &) {
+                        return input;
+                    }
+
+                    /*!
+                     * @brief Appends the tag to the output. Always succeeds.
+                     */
+                    template<typename OutputContainer>
+                    inline static bool finish_tag(const tag_type &tag, const tag_type &, OutputContainer &output) {
+                        output.insert(output.end(), tag.begin(), tag.end());
+                        return true;
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct ocb_decryption_policy : public ocb_policy<Cipher, Padding> {
+                    typedef typename ocb_policy<Cipher, Padding>::cipher_type cipher_type;
+                    typedef typename ocb_policy<Cipher, Padding>::block_type block_type;
+                    typedef typename ocb_policy<Cipher, Padding>::bytes_type bytes_type;
+                    typedef typename ocb_policy<Cipher, Padding>::tag_type tag_type;
+
+                    inline static void process_n(const cipher_type &cipher, const block_type *ciphertext,
+                                                 block_type *plaintext, std::size_t n) {
+                        cipher.decrypt_n(ciphertext, plaintext, n);
+                    }
+
+                    template<typename T>
+                    inline static const T &plaintext(const T &, const T &output) {
+                        return output;
+                    }
+
+                    /*!
+                     * @brief Compares the tag with the received one in constant time. On mismatch the
+                     * decrypted output is wiped.
+                     */
+                    template<typename OutputContainer>
+                    inline static bool finish_tag(const tag_type &tag, const tag_type &received,
+                                                  OutputContainer &output) {
+                        if (!constant_time_compare(tag.data(), received.data(), tag.size())) {
+                            std::fill(output.begin(), output.end(), 0);
+                            output.clear();
+                            return false;
+                        }
+                        return true;
+                    }
+                };
+
+                /*!
+                 * @brief Offset codebook mode, OCB3 (RFC 7253), with 128-bit tags. Each block is
+                 * whitened with an offset taken from the precomputed L_i table, so blocks are
+                 * independent and process_n hands policy_type::pipeline_blocks of them to the cipher at
+                 * once. The plaintext checksum is accumulated as blocks go by.
+                 *
+                 * As with gcm, the received tag is passed to the constructor on decryption and checked
+                 * by finish_message before the plaintext is released. Messages handled with process_n
+                 * are finished with end_message and finish_message on their last block.
+                 */
+                template<typename Policy>
+                class ocb {
+                    typedef Policy policy_type;
+
+                    typedef typename policy_type::bytes_type bytes_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    constexpr static const size_type tag_bits = policy_type::tag_bits;
+                    typedef typename policy_type::tag_type tag_type;
+
+                    BOOST_STATIC_ASSERT_MSG(block_bits == 128, "OCB is defined for 128-bit block ciphers only");
+
+                    template<typename NonceRange>
+                    ocb(const cipher_type &cipher, const NonceRange &nonce) :
+                        ocb(cipher, nonce, std::vector<std::uint8_t>()) {
+                    }
+
+                    /*!
+                     * @throws std::invalid_argument if the nonce is empty or longer than 120 bits.
+                     */
+                    template<typename NonceRange, typename AadRange>
+                    ocb(const cipher_type &cipher, const NonceRange &nonce, const AadRange &aad) :
+                        cipher(cipher), index(0), received_tag() {
+                        const std::vector<std::uint8_t> nonce_bytes(std::begin(nonce), std::end(nonce));
+                        if (nonce_bytes.empty() || nonce_bytes.size() >= policy_type::block_bytes) {
+                            throw std::invalid_argument("ocb nonce has to be 1 to 15 bytes long");
+                        }
+
+                        l_star = policy_type::encrypt(cipher, bytes_type());
+                        l_dollar = policy_type::double_block(l_star);
+                        bytes_type li = policy_type::double_block(l_dollar);
+                        for (size_type i = 0; i != l.size(); ++i) {
+                            l[i] = policy_type::from_bytes(li);
+                            li = policy_type::double_block(li);
+                        }
+
+                        bytes_type top = {0};
+                        top[0] = static_cast<std::uint8_t>((tag_bits % 128) << 1);
+                        top[policy_type::block_bytes - 1 - nonce_bytes.size()] |= 1;
+                        std::copy(nonce_bytes.begin(), nonce_bytes.end(), top.end() - nonce_bytes.size());
+
+                        const size_type bottom = top[policy_type::block_bytes - 1] & 0x3f;
+                        top[policy_type::block_bytes - 1] &= 0xc0;
+                        top = policy_type::encrypt(cipher, top);
+
+                        std::array<std::uint8_t, policy_type::block_bytes + 8> stretch;
+                        std::copy(top.begin(), top.end(), stretch.begin());
+                        for (size_type i = 0; i != 8; ++i) {
+                            stretch[policy_type::block_bytes + i] = top[i] ^ top[i + 1];
+                        }
+
+                        bytes_type initial_offset;
+                        const size_type shift = bottom % CHAR_BIT;
+                        for (size_type i = 0; i != policy_type::block_bytes; ++i) {
+                            initial_offset[i] = static_cast<std::uint8_t>(
+                                (stretch[i + bottom / CHAR_BIT] << shift) |
+                                (shift ? stretch[i + bottom / CHAR_BIT + 1] >> (CHAR_BIT - shift) : 0));
+                        }
+                        offset = policy_type::from_bytes(initial_offset);
+                        checksum = policy_type::from_bytes(bytes_type());
+
+                        hash_aad(std::vector<std::uint8_t>(std::begin(aad), std::end(aad)));
+                    }
+
+                    /*!
+                     * @param tag Tag received with the message, checked by finish_message on decryption.
+                     * A decrypting instance constructed without one fails to authenticate any message.
+                     * @throws std::invalid_argument if the nonce is empty or longer than 120 bits, or the
+                     * tag is not tag_bits long.
+                     */
+                    template<typename NonceRange, typename AadRange, typename TagRange>
+                    ocb(const cipher_type &cipher, const NonceRange &nonce, const AadRange &aad, const TagRange &tag) :
+                        ocb(cipher, nonce, aad) {
+                        const std::vector<std::uint8_t> tag_bytes(std::begin(tag), std::end(tag));
+                        if (tag_bytes.size() != received_tag.size()) {
+                            throw std::invalid_argument("ocb tag has to be 16 bytes long");
+                        }
+                        std::copy(tag_bytes.begin(), tag_bytes.end(), received_tag.begin());
+                    }
+
+                    ~ocb() {
+                        l_star.fill(0);
+                        l_dollar.fill(0);
+                        l.fill(block_type());
+                        offset.fill(0);
+                        checksum.fill(0);
+                        aad_hash.fill(0);
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &input, std::size_t total_seen) {
+                        block_type output;
+                        process_n(&input, &output, 1);
+                        return output;
+                    }
+
+                    block_type end_message(const block_type &input, std::size_t total_seen) const {
+                        block_type last_offset = offset, last_checksum = checksum;
+                        return finish(input, total_seen, last_offset, last_checksum);
+                    }
+
+                    /*!
+                     * @brief Authenticates the message. The last block of the message is passed in as it
+                     * was handed to end_message, together with the message length in bits, and output
+                     * holds the processed message. On encryption the tag is appended to output, on
+                     * decryption it is compared with the received one in constant time.
+                     * @return false if decryption failed to authenticate, in which case output is wiped.
+                     */
+                    template<typename OutputContainer>
+                    bool finish_message(const block_type &input, std::size_t total_seen,
+                                        OutputContainer &output) const {
+                        tag_type result_tag = tag(input, total_seen);
+                        const bool result = policy_type::finish_tag(result_tag, received_tag, output);
+                        result_tag.fill(0);
+                        return result;
+                    }
+
+                    /*!
+                     * @brief Processes n whole blocks, continuing the message of previous calls. In-place
+                     * operation is allowed.
+                     */
+                    void process_n(const block_type *input, block_type *output, std::size_t n) {
+                        std::array<block_type, policy_type::pipeline_blocks> offsets, whitened, processed;
+
+                        // Kept in locals, since stores to output could otherwise alias the members
+                        block_type current_offset = offset, current_checksum = checksum;
+                        size_type current_index = index;
+
+                        while (n != 0) {
+                            const size_type blocks =
+                                n < policy_type::pipeline_blocks ? n : policy_type::pipeline_blocks;
+
+                            for (size_type i = 0; i != blocks; ++i) {
+                                current_offset =
+                                    policy_type::xor_block(current_offset, l[policy_type::ntz(++current_index)]);
+                                offsets[i] = current_offset;
+                                whitened[i] = policy_type::xor_block(input[i], current_offset);
+                            }
+
+                            policy_type::process_n(cipher, whitened.data(), processed.data(), blocks);
+
+                            for (size_type i = 0; i != blocks; ++i) {
+                                const block_type out = policy_type::xor_block(processed[i], offsets[i]);
+                                current_checksum =
+                                    policy_type::xor_block(current_checksum, policy_type::plaintext(input[i], out));
+                                output[i] = out;
+                            }
+
+                            input += blocks;
+                            output += blocks;
+                            n -= blocks;
+                        }
+
+                        offset = current_offset;
+                        checksum = current_checksum;
+                        index = current_index;
+                    }
+
+                protected:
+                    tag_type tag(const block_type &input, std::size_t total_seen) const {
+                        block_type last_offset = offset, last_checksum = checksum;
+                        finish(input, total_seen, last_offset, last_checksum);
+
+                        const bytes_type full = policy_type::encrypt(
+                            cipher, policy_type::xor_bytes(
+                                        policy_type::to_bytes(policy_type::xor_block(last_checksum, last_offset)),
+                                        l_dollar));
+
+                        tag_type result;
+                        for (size_type i = 0; i != result.size(); ++i) {
+                            result[i] = full[i] ^ aad_hash[i];
+                        }
+                        return result;
+                    }
+
+                    block_type finish(const block_type &input, std::size_t total_seen, block_type &last_offset,
+                                      block_type &last_checksum) const {
+                        if (total_seen == 0) {
+                            return input;
+                        }
+
+                        const size_type last_bits = total_seen % block_bits;
+
+                        if (last_bits == 0) {
+                            last_offset = policy_type::xor_block(last_offset, l[policy_type::ntz(index + 1)]);
+
+                            block_type processed;
+                            const block_type whitened = policy_type::xor_block(input, last_offset);
+                            policy_type::process_n(cipher, &whitened, &processed, 1);
+
+                            const block_type out = policy_type::xor_block(processed, last_offset);
+                            last_checksum = policy_type::xor_block(last_checksum, policy_type::plaintext(input, out));
+                            return out;
+                        }
+
+                        const bytes_type star_offset =
+                            policy_type::xor_bytes(policy_type::to_bytes(last_offset), l_star);
+                        last_offset = policy_type::from_bytes(star_offset);
+
+                        const bytes_type in = policy_type::to_bytes(input);
+                        const bytes_type out = policy_type::xor_bytes(in, policy_type::encrypt(cipher, star_offset));
+
+                        bytes_type padded = {0};
+                        const bytes_type &plaintext = policy_type::plaintext(in, out);
+                        std::copy(plaintext.begin(), plaintext.begin() + last_bits / CHAR_BIT, padded.begin());
+                        padded[last_bits / CHAR_BIT] = 0x80;
+                        last_checksum = policy_type::xor_block(last_checksum, policy_type::from_bytes(padded));
+
+                        return policy_type::from_bytes(out);
+                    }
+
+                    void hash_aad(const std::vector<std::uint8_t> &aad) {
+                        const size_type full_blocks = aad.size() / policy_type::block_bytes;
+
+                        std::vector<block_type> whitened(full_blocks + 1), processed(full_blocks + 1);
+                        bytes_type aad_offset = {0}, block;
+                        for (size_type i = 0; i != full_blocks; ++i) {
+                            aad_offset =
+                                policy_type::xor_bytes(aad_offset, policy_type::to_bytes(l[policy_type::ntz(i + 1)]));
+                            std::copy(aad.begin() + i * policy_type::block_bytes,
+                                      aad.begin() + (i + 1) * policy_type::block_bytes, block.begin());
+                            whitened[i] = policy_type::from_bytes(policy_type::xor_bytes(block, aad_offset));
+                        }
+
+                        size_type blocks = full_blocks;
+                        if (aad.size() % policy_type::block_bytes) {
+                            aad_offset = policy_type::xor_bytes(aad_offset, l_star);
+                            block.fill(0);
+                            std::copy(aad.begin() + full_blocks * policy_type::block_bytes, aad.end(), block.begin());
+                            block[aad.size() % policy_type::block_bytes] = 0x80;
+                            whitened[blocks++] = policy_type::from_bytes(policy_type::xor_bytes(block, aad_offset));
+                        }
+
+                        if (blocks != 0) {
+                            cipher.encrypt_n(whitened.data(), processed.data(), blocks);
+                        }
+
+                        aad_hash.fill(0);
+                        for (size_type i = 0; i != blocks; ++i) {
+                            aad_hash = policy_type::xor_bytes(aad_hash, policy_type::to_bytes(processed[i]));
+                        }
+                    }
+
+                    cipher_type cipher;
+
+                    bytes_type l_star, l_dollar;
+                    std::array<block_type, policy_type::offset_table_size> l;
+
+                    block_type offset;
+                    block_type checksum;
+                    bytes_type aad_hash;
+                    size_type index;
+                    tag_type received_tag;
+                };
+
+                template<typename Cipher, typename Padding>
+                struct xts_policy {
+                    typedef std::size_t size_type;
+
+                    typedef Cipher cipher_type;
+                    typedef Padding padding_type;
+
+                    constexpr static const size_type block_bits = cipher_type::block_bits;
+                    constexpr static const size_type block_words = cipher_type::block_words;
+                    typedef typename cipher_type::block_type block_type;
+
+                    typedef typename cipher_type::endian_type endian_type;
+
+                    constexpr static const size_type value_bits =
+                        sizeof(typename block_type::value_type) * CHAR_BIT;
+
+                    constexpr static const size_type block_bytes = block_bits / CHAR_BIT;
+                    typedef xts_tweak::block_type tweak_type;
+
+                    /*!
+                     * @brief Amount of blocks of a data unit passed to the cipher at once, as in ctr.
+                     */
+                    constexpr static const size_type pipeline_blocks = 16;
+
+                    /*!
+                     * @brief Encrypts the sector number, little-endian, with the tweak key.
+                     */
+                    inline static tweak_type sector_tweak(const cipher_type &tweak_cipher, std::uint64_t sector) {
+                        tweak_type bytes = {0};
+                        for (size_type i = 0; i != sizeof(sector); ++i) {
+                            bytes[i] = static_cast<std::uint8_t>(sector >> (8 * i));
+                        }
+                        return to_bytes(tweak_cipher.encrypt(from_bytes(bytes.data())));
+                    }
+
+                    inline static tweak_type to_bytes(const block_type &block) {
+                        tweak_type bytes;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, value_bits, CHAR_BIT>(
+                            block.begin(), block.end(), bytes.begin());
+                        return bytes;
+                    }
+
+                    inline static block_type from_bytes(const std::uint8_t *bytes) {
+                        block_type block;
+                        ::nil::crypto3::detail::pack<endian_type, endian_type, CHAR_BIT, value_bits>(
+                            bytes, bytes + block_bytes, block.begin());
+                        return block;
+                    }
+
+                    inline static block_type apply_tweak(const block_type &block, const tweak_type &tweak) {
+                        tweak_type bytes = to_bytes(block);
+                        for (size_type i = 0; i != block_bytes; ++i) {
+                            bytes[i] ^= tweak[i];
+                        }
+                        return from_bytes(bytes.data());
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct xts_encryption_policy : public xts_policy<Cipher, Padding> {
+                    typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
+                    typedef typename xts_policy<Cipher, Padding>::block_type block_type;
+
+                    inline static block_type process(const cipher_type &cipher, const block_type &plaintext) {
+                        return cipher.encrypt(plaintext);
+                    }
+
+                    inline static void process_n(const cipher_type &cipher, const block_type *plaintext,
+                                                 block_type *ciphertext, std::size_t n) {
+                        cipher.encrypt_n(plaintext, ciphertext, n);
+                    }
+                };
+
+                template<typename Cipher, typename Padding>
+                struct xts_decryption_policy : public xts_policy<Cipher, Padding> {
+                    typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
+                    typedef typename xts_policy<Cipher, Padding>::block_type block_type;
+
+                    inline static block_type process(const cipher_type &cipher, const block_type &ciphertext) {
+                        return cipher.decrypt(ciphertext);
+                    }
+
+                    inline static void process_n(const cipher_type &cipher, const block_type *ciphertext,
+                                                 block_type *plaintext, std::size_t n) {
+                        cipher.decrypt_n(ciphertext, plaintext, n);
+                    }
+                };
+
+                /*!
+                 * @brief XTS mode (IEEE 1619, NIST SP 800-38E) for storage encryption. Each data unit
+                 * (sector) is processed under its own tweak, the sector number encrypted with a second,
+                 * independent key. Ciphertext stealing is not supported, so data units have to be a
+                 * multiple of the block size.
+                 *
+                 * Whole sectors are best processed with process_sector or process_sectors, which compute
+                 * policy_type::pipeline_blocks tweaks at once and hand as many blocks to the cipher.
+                 * Through the block pipeline the mode processes a single data unit.
+                 */
+                template<typename Policy>
+                class xts {
+                    typedef Policy policy_type;
+
+                    typedef typename policy_type::tweak_type tweak_type;
+
+                public:
+                    typedef typename policy_type::cipher_type cipher_type;
+                    typedef typename policy_type::padding_type padding_type;
+
+                    typedef typename policy_type::size_type size_type;
+
+                    typedef typename cipher_type::key_type key_type;
+
+                    typedef typename policy_type::endian_type endian_type;
+
+                    typedef typename cipher_type::block_type block_type;
+                    typedef typename cipher_type::word_type word_type;
+
+                    constexpr static const size_type block_bits = policy_type::block_bits;
+                    constexpr static const size_type block_words = policy_type::block_words;
+                    constexpr static const size_type word_bits = cipher_type::word_bits;
+
+                    BOOST_STATIC_ASSERT_MSG(block_bits == 128, "XTS is defined for 128-bit block ciphers only");
+
+                    xts(const cipher_type &cipher, const cipher_type &tweak_cipher, std::uint64_t sector = 0) :
+                        cipher(cipher), tweak_cipher(tweak_cipher),
+                        tweak(policy_type::sector_tweak(tweak_cipher, sector)) {
+                    }
+
+                    ~xts() {
+                        tweak.fill(0);
+                    }
+
+                    block_type begin_message(const block_type &plaintext, std::size_t total_seen) {
+                        return process_block(plaintext, total_seen);
+                    }
+
+                    block_type process_block(const block_type &input, std::size_t total_seen) {
+                        tweak_type current;
+                        xts_tweak::sequence(tweak, &current, 1);
+                        return policy_type::apply_tweak(
+                            policy_type::process(cipher, policy_type::apply_tweak(input, current)), current);
+                    }
+
+                    block_type end_message(const block_type &input, std::size_t total_seen) const {
+                        return policy_type::apply_tweak(
+                            policy_type::process(cipher, policy_type::apply_tweak(input, tweak)), tweak);
+                    }
+
+                    /*!
+                     * @brief Processes one data unit of the given sector in place.
+                     * @throws std::invalid_argument if bytes is not a multiple of the block size.
+                     */
+                    void process_sector(std::uint64_t sector, std::uint8_t *data, std::size_t bytes) const {
+                        if (bytes % policy_type::block_bytes != 0) {
+                            throw std::invalid_argument("xts data unit is not a multiple of the block size");
+                        }
+
+                        tweak_type sector_tweak = policy_type::sector_tweak(tweak_cipher, sector);
+
+                        std::array<tweak_type, policy_type::pipeline_blocks> tweaks;
+                        std::array<block_type, policy_type::pipeline_blocks> blocks, processed;
+
+                        for (size_type left = bytes / policy_type::block_bytes; left != 0;) {
+                            const size_type n =
+                                left < policy_type::pipeline_blocks ? left : policy_type::pipeline_blocks;
+
+                            xts_tweak::sequence(sector_tweak, tweaks.data(), n);
+                            for (size_type i = 0; i != n; ++i) {
+                                blocks[i] = policy_type::apply_tweak(
+                                    policy_type::from_bytes(data + i * policy_type::block_bytes), tweaks[i]);
+                            }
+
+                            policy_type::process_n(cipher, blocks.data(), processed.data(), n);
+
+                            for (size_type i = 0; i != n; ++i) {
+                                const tweak_type out =
+                                    policy_type::to_bytes(policy_type::apply_tweak(processed[i], tweaks[i]));
+                                std::copy(out.begin(), out.end(), data + i * policy_type::block_bytes);
+                            }
+
+                            data += n * policy_type::block_bytes;
+                            left -= n;
+                        }
+
+                        sector_tweak.fill(0);
+                        tweaks.fill(tweak_type());
+                    }
+
+                    /*!
+                     * @brief Processes a batch of data units in place. Each element is a pair of a sector
+                     * number and a contiguous byte container, such as std::pair<std::uint64_t,
+                     * std::vector<std::uint8_t>>.
+                     */
+                    template<typename InputIterator>
+                    void process_sectors(InputIterator first, InputIterator last) const {
+                        for (; first != last; ++first) {
+                            process_sector(first->first, first->second.data(), first->second.size());
+                        }
+                    }
+
+                protected:
+                    cipher_type cipher;
+                    cipher_type tweak_cipher;
+                    tweak_type tweak;
+                };
+
+                /*!
+                 * @brief Detects authenticated modes, which append a tag_bits long tag to their output.
+                 */
+                template<typename Mode, typename = void>
+                struct is_aead_mode : std::false_type { };
+
+                template<typename Mode>
+                struct is_aead_mode<Mode, typename std::enable_if<(Mode::tag_bits > 0)>::type> : std::true_type { };
+
+                /*!
+                 * @brief Detects modes which encrypt with a keystream and so emit exactly as many octets
+                 * as they were given: counter mode and the authenticated modes.
+                 */
+                template<typename Mode>
+                struct is_stream_mode : is_aead_mode<Mode> { };
+
+                template<typename Policy>
+                struct is_stream_mode<ctr<Policy>> : std::true_type { };
+
+                /*!
+                 * @brief Detects authenticated decryptions, whose output must not be released before
+                 * finish_message has checked the tag.
+                 */
+                template<typename Mode>
+                struct is_authenticated_decryption : std::false_type { };
+
+                template<typename Cipher, typename Padding>
+                struct is_authenticated_decryption<gcm<gcm_decryption_policy<Cipher, Padding>>> : std::true_type { };
+
+                template<typename Cipher, typename Padding>
+                struct is_authenticated_decryption<gcm_siv<gcm_siv_decryption_policy<Cipher, Padding>>>
+                    : std::true_type { };
+
+                template<typename Cipher, typename Padding>
+                struct is_authenticated_decryption<ccm<ccm_decryption_policy<Cipher, Padding>>> : std::true_type { };
+
+                template<typename Cipher, typename Padding>
+                struct is_authenticated_decryption<ocb<ocb_decryption_policy<Cipher, Padding>>> : std::true_type { };
+            }    // namespace detail
+
+            namespace modes {
+
+                template<typename Cipher, template<typename> class Padding>
+                struct isomorphic {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::isomorphic_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::isomorphic_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::isomorphic<Policy> type;
+                    };
+                };
+
+                template<typename Cipher, template<typename> class Padding>
+                struct cbc {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::cbc_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::cbc_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::cbc<Policy> type;
+                    };
+                };
+
+                template<typename Cipher, template<typename> class Padding>
+                struct ctr {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::ctr_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::ctr_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::ctr<Policy> type;
+                    };
+                };
+
+                template<typename Cipher, template<typename> class Padding>
+                struct gcm {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::gcm_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::gcm_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::gcm<Policy> type;
+                    };
+                };
+
+                template<typename Cipher, template<typename> class Padding>
+                struct gcm_siv {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::gcm_siv_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::gcm_siv_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::gcm_siv<Policy> type;
+                    };
+                };
+
+                template<typename Cipher, template<typename> class Padding>
+                struct ccm {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::ccm_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::ccm_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::ccm<Policy> type;
+                    };
+                };
+
+                template<typename Cipher, template<typename> class Padding>
+                struct ocb {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::ocb_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::ocb_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::ocb<Policy> type;
+                    };
+                };
+
+                template<typename Cipher, template<typename> class Padding>
+                struct xts {
+                    typedef Cipher cipher_type;
+                    typedef Padding<Cipher> padding_type;
+
+                    typedef detail::xts_encryption_policy<cipher_type, padding_type> encryption_policy;
+                    typedef detail::xts_decryption_policy<cipher_type, padding_type> decryption_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::xts<Policy> type;
                     };
                 };
             }    // namespace modes
@@ -0,0 +1,166 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_GHASH_CLMUL_IMPL_HPP
+#define CRYPTO3_GHASH_CLMUL_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include <nil/crypto3/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*
+                 * Operands are byte-reflected into little-endian order and multiplied with the
+                 * schoolbook four PCLMULQDQ method from the Intel carry-less multiplication guide.
+                 * Products are accumulated unreduced, then shifted left by one bit (GCM bit
+                 * reflection) and reduced modulo x^128 + x^7 + x^2 + x + 1 once.
+                 */
+
+                BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                inline __m128i ghash_clmul_bswap(__m128i x) {
+                    return _mm_shuffle_epi8(x, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+                }
+
+                BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                inline void ghash_clmul_mul_acc(__m128i a, __m128i b, __m128i &lo, __m128i &hi) {
+                    const __m128i t0 = _mm_clmulepi64_si128(a, b, 0x00);
+                    const __m128i t1 = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01));
+                    const __m128i t3 = _mm_clmulepi64_si128(a, b, 0x11);
+
+                    lo = _mm_xor_si128(lo, _mm_xor_si128(t0, _mm_slli_si128(t1, 8)));
+                    hi = _mm_xor_si128(hi, _mm_xor_si128(t3, _mm_srli_si128(t1, 8)));
+                }
+
+                BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                inline __m128i ghash_clmul_reduce(__m128i lo, __m128i hi) {
+                    // shift the 256-bit product [hi:lo] left by one bit
+                    __m128i c0 = _mm_srli_epi32(lo, 31);
+                    __m128i c1 = _mm_srli_epi32(hi, 31);
+                    lo = _mm_slli_epi32(lo, 1);
+                    hi = _mm_slli_epi32(hi, 1);
+
+                    const __m128i carry = _mm_srli_si128(c0, 12);
+                    c1 = _mm_slli_si128(c1, 4);
+                    c0 = _mm_slli_si128(c0, 4);
+                    lo = _mm_or_si128(lo, c0);
+                    hi = _mm_or_si128(_mm_or_si128(hi, c1), carry);
+
+                    // reduce
+                    __m128i a = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)),
+                                              _mm_slli_epi32(lo, 25));
+                    const __m128i b = _mm_srli_si128(a, 4);
+                    a = _mm_slli_si128(a, 12);
+                    lo = _mm_xor_si128(lo, a);
+
+                    __m128i d = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)),
+                                              _mm_srli_epi32(lo, 7));
+                    d = _mm_xor_si128(d, b);
+                    lo = _mm_xor_si128(lo, d);
+
+                    return _mm_xor_si128(hi, lo);
+                }
+
+                BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                inline __m128i ghash_clmul_multiply(__m128i a, __m128i b) {
+                    __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                    ghash_clmul_mul_acc(a, b, lo, hi);
+                    return ghash_clmul_reduce(lo, hi);
+                }
+
+                /*!
+                 * @brief GHASH with carry-less multiplication. Eight blocks are folded per
+                 * reduction using the precomputed powers H^1..H^8:
+                 * X' = (X + C1)H^8 + C2H^7 + ... + C8H.
+                 */
+                struct ghash_clmul_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    constexpr static const std::size_t aggregated_blocks = 8;
+
+                    struct key_type {
+                        // byte-reflected H^(i + 1) at offset 16 * i
+                        std::array<std::uint8_t, 16 * aggregated_blocks> powers;
+                    };
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void schedule_key(key_type &key, const block_type &h) {
+                        __m128i *powers = reinterpret_cast<__m128i *>(key.powers.data());
+
+                        const __m128i h1 = ghash_clmul_bswap(_mm_loadu_si128(reinterpret_cast<const __m128i *>(h.data())));
+                        __m128i hi = h1;
+                        _mm_storeu_si128(powers, h1);
+                        for (std::size_t i = 1; i != aggregated_blocks; ++i) {
+                            hi = ghash_clmul_multiply(hi, h1);
+                            _mm_storeu_si128(powers + i, hi);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void update(block_type &x, const key_type &key, const std::uint8_t *in, std::size_t n) {
+                        const __m128i *powers = reinterpret_cast<const __m128i *>(key.powers.data());
+                        const __m128i *in_mm = reinterpret_cast<const __m128i *>(in);
+
+                        __m128i X = ghash_clmul_bswap(_mm_loadu_si128(reinterpret_cast<const __m128i *>(x.data())));
+
+                        for (; n >= aggregated_blocks; n -= aggregated_blocks, in_mm += aggregated_blocks) {
+                            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+
+                            ghash_clmul_mul_acc(_mm_xor_si128(X, ghash_clmul_bswap(_mm_loadu_si128(in_mm))),
+                                                _mm_loadu_si128(powers + aggregated_blocks - 1), lo, hi);
+                            for (std::size_t i = 1; i != aggregated_blocks; ++i) {
+                                ghash_clmul_mul_acc(ghash_clmul_bswap(_mm_loadu_si128(in_mm + i)),
+                                                    _mm_loadu_si128(powers + aggregated_blocks - 1 - i), lo, hi);
+                            }
+
+                            X = ghash_clmul_reduce(lo, hi);
+                        }
+
+                        for (; n; --n, ++in_mm) {
+                            X = ghash_clmul_multiply(_mm_xor_si128(X, ghash_clmul_bswap(_mm_loadu_si128(in_mm))),
+                                                     _mm_loadu_si128(powers));
+                        }
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(x.data()), ghash_clmul_bswap(X));
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_GHASH_CLMUL_IMPL_HPP
@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_GHASH_IMPL_HPP
+#define CRYPTO3_GHASH_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief Portable GHASH with Shoup's 4-bit tables: sixteen multiples of H and a
+                 * fixed reduction table. The lookups are indexed by the data being hashed, so this
+                 * implementation is not constant-time; it is used only where carry-less multiply
+                 * instructions are unavailable.
+                 */
+                struct ghash_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    struct key_type {
+                        std::array<std::uint64_t, 16> hh, hl;
+                    };
+
+                    static std::uint64_t load_be64(const std::uint8_t *p) {
+                        std::uint64_t r = 0;
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            r = (r << 8) | p[i];
+                        }
+                        return r;
+                    }
+
+                    static void store_be64(std::uint8_t *p, std::uint64_t x) {
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            p[i] = static_cast<std::uint8_t>(x >> (56 - 8 * i));
+                        }
+                    }
+
+                    static void schedule_key(key_type &key, const block_type &h) {
+                        std::uint64_t vh = load_be64(h.data()), vl = load_be64(h.data() + 8);
+
+                        key.hh[0] = key.hl[0] = 0;
+                        key.hh[8] = vh;
+                        key.hl[8] = vl;
+
+                        // entries 4, 2, 1 are H times x, x^2, x^3
+                        for (std::size_t i = 4; i > 0; i >>= 1) {
+                            const std::uint64_t t = (vl & 1) * 0xe100000000000000ULL;
+                            vl = (vh << 63) | (vl >> 1);
+                            vh = (vh >> 1) ^ t;
+                            key.hh[i] = vh;
+                            key.hl[i] = vl;
+                        }
+
+                        for (std::size_t i = 2; i <= 8; i *= 2) {
+                            for (std::size_t j = 1; j < i; ++j) {
+                                key.hh[i + j] = key.hh[i] ^ key.hh[j];
+                                key.hl[i + j] = key.hl[i] ^ key.hl[j];
+                            }
+                        }
+                    }
+
+                    static void multiply(block_type &x, const key_type &key) {
+                        constexpr static const std::uint16_t last4[16] = {
+                            0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+                            0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0};
+
+                        std::uint8_t lo = x[15] & 0x0f;
+                        std::uint64_t zh = key.hh[lo], zl = key.hl[lo];
+
+                        for (std::size_t k = 16; k-- > 0;) {
+                            lo = x[k] & 0x0f;
+                            const std::uint8_t hi = x[k] >> 4;
+
+                            if (k != 15) {
+                                const std::uint8_t rem = zl & 0x0f;
+                                zl = (zh << 60) | (zl >> 4);
+                                zh = (zh >> 4) ^ (static_cast<std::uint64_t>(last4[rem]) << 48);
+                                zh ^= key.hh[lo];
+                                zl ^= key.hl[lo];
+                            }
+
+                            const std::uint8_t rem = zl & 0x0f;
+                            zl = (zh << 60) | (zl >> 4);
+                            zh = (zh >> 4) ^ (static_cast<std::uint64_t>(last4[rem]) << 48);
+                            zh ^= key.hh[hi];
+                            zl ^= key.hl[hi];
+                        }
+
+                        store_be64(x.data(), zh);
+                        store_be64(x.data() + 8, zl);
+                    }
+
+                    static void update(block_type &x, const key_type &key, const std::uint8_t *in, std::size_t n) {
+                        for (; n; --n, in += 16) {
+                            for (std::size_t i = 0; i != 16; ++i) {
+                                x[i] ^= in[i];
+                            }
+                            multiply(x, key);
+                        }
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_GHASH_IMPL_HPP
@@ -0,0 +1,150 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+
+#ifndef CRYPTO3_POLYVAL_HPP
+#define CRYPTO3_POLYVAL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/block/detail/polyval/polyval_impl.hpp>
+
+#if BOOST_ARCH_X86
+#include <nil/crypto3/block/detail/polyval/polyval_clmul_impl.hpp>
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief POLYVAL universal hash (RFC 8452), as used by GCM-SIV. The carry-less
+                 * multiply implementation is chosen at runtime when the processor has PCLMULQDQ,
+                 * otherwise the table implementation shared with GHASH is used.
+                 */
+                class polyval {
+                public:
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    constexpr static const std::size_t block_bytes = 16;
+
+                    explicit polyval(const block_type &h) : state(), clmul(use_clmul()) {
+#if BOOST_ARCH_X86
+                        if (clmul) {
+                            polyval_clmul_impl::schedule_key(clmul_key, h);
+                            return;
+                        }
+#endif
+                        polyval_impl::schedule_key(table_key, h);
+                    }
+
+                    ~polyval() {
+                        state.fill(0);
+#if BOOST_ARCH_X86
+                        clmul_key.powers.fill(0);
+#endif
+                        table_key.hh.fill(0);
+                        table_key.hl.fill(0);
+                    }
+
+                    /*!
+                     * @brief Absorbs n whole 16-byte blocks.
+                     */
+                    void update(const std::uint8_t *in, std::size_t n) {
+#if BOOST_ARCH_X86
+                        if (clmul) {
+                            polyval_clmul_impl::update(state, clmul_key, in, n);
+                            return;
+                        }
+#endif
+                        polyval_impl::update(state, table_key, in, n);
+                    }
+
+                    /*!
+                     * @brief Absorbs an arbitrary byte string, zero-padding its last block.
+                     */
+                    void update_padded(const std::uint8_t *in, std::size_t bytes) {
+                        update(in, bytes / block_bytes);
+
+                        if (bytes % block_bytes) {
+                            block_type last = {0};
+                            for (std::size_t i = 0; i != bytes % block_bytes; ++i) {
+                                last[i] = in[bytes - bytes % block_bytes + i];
+                            }
+                            update(last.data(), 1);
+                        }
+                    }
+
+                    /*!
+                     * @brief Absorbs the final length block, holding both lengths in bits, little-endian.
+                     */
+                    void update_lengths(std::uint64_t first_bits, std::uint64_t second_bits) {
+                        block_type lengths;
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            lengths[i] = static_cast<std::uint8_t>(first_bits >> (8 * i));
+                            lengths[8 + i] = static_cast<std::uint8_t>(second_bits >> (8 * i));
+                        }
+                        update(lengths.data(), 1);
+                    }
+
+                    const block_type &digest() const {
+                        return state;
+                    }
+
+                    static bool use_clmul() {
+#if BOOST_ARCH_X86
+                        static const bool available = cpuid::has_clmul() && cpuid::has_ssse3();
+                        return available;
+#else
+                        return false;
+#endif
+                    }
+
+                protected:
+                    block_type state;
+                    bool clmul;
+
+#if BOOST_ARCH_X86
+                    polyval_clmul_impl::key_type clmul_key;
+#endif
+                    polyval_impl::key_type table_key;
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_POLYVAL_HPP
@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+
+#ifndef CRYPTO3_POLYVAL_CLMUL_IMPL_HPP
+#define CRYPTO3_POLYVAL_CLMUL_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#include <nil/crypto3/block/detail/ghash/ghash_clmul_impl.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*
+                 * POLYVAL works on little-endian operands, so unlike GHASH no byte or bit reflection is
+                 * needed. The 256-bit product is reduced with two Montgomery folding steps by
+                 * x^128 + x^127 + x^126 + x^121 + 1, which also supplies the x^-128 factor of dot().
+                 */
+
+                BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                inline __m128i polyval_clmul_reduce(__m128i lo, __m128i hi) {
+                    const __m128i poly = _mm_set_epi64x(static_cast<long long>(0xc200000000000000ULL), 1);
+
+                    __m128i t = _mm_clmulepi64_si128(lo, poly, 0x10);
+                    lo = _mm_xor_si128(_mm_shuffle_epi32(lo, 0x4e), t);
+                    t = _mm_clmulepi64_si128(lo, poly, 0x10);
+                    lo = _mm_xor_si128(_mm_shuffle_epi32(lo, 0x4e), t);
+
+                    return _mm_xor_si128(hi, lo);
+                }
+
+                BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                inline __m128i polyval_clmul_dot(__m128i a, __m128i b) {
+                    __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                    ghash_clmul_mul_acc(a, b, lo, hi);
+                    return polyval_clmul_reduce(lo, hi);
+                }
+
+                /*!
+                 * @brief POLYVAL with carry-less multiplication. Eight blocks are folded per
+                 * reduction using the powers H, dot(H, H), ..., as in ghash_clmul_impl.
+                 */
+                struct polyval_clmul_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+                    constexpr static const std::size_t aggregated_blocks = 8;
+
+                    struct key_type {
+                        // H^(i + 1) in the POLYVAL field at offset 16 * i
+                        std::array<std::uint8_t, 16 * aggregated_blocks> powers;
+                    };
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void schedule_key(key_type &key, const block_type &h) {
+                        __m128i *powers = reinterpret_cast<__m128i *>(key.powers.data());
+
+                        const __m128i h1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h.data()));
+                        __m128i hi = h1;
+                        _mm_storeu_si128(powers, h1);
+                        for (std::size_t i = 1; i != aggregated_blocks; ++i) {
+                            hi = polyval_clmul_dot(hi, h1);
+                            _mm_storeu_si128(powers + i, hi);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void update(block_type &x, const key_type &key, const std::uint8_t *in, std::size_t n) {
+                        const __m128i *powers = reinterpret_cast<const __m128i *>(key.powers.data());
+                        const __m128i *in_mm = reinterpret_cast<const __m128i *>(in);
+
+                        __m128i X = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x.data()));
+
+                        for (; n >= aggregated_blocks; n -= aggregated_blocks, in_mm += aggregated_blocks) {
+                            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+
+                            ghash_clmul_mul_acc(_mm_xor_si128(X, _mm_loadu_si128(in_mm)),
+                                                _mm_loadu_si128(powers + aggregated_blocks - 1), lo, hi);
+                            for (std::size_t i = 1; i != aggregated_blocks; ++i) {
+                                ghash_clmul_mul_acc(_mm_loadu_si128(in_mm + i),
+                                                    _mm_loadu_si128(powers + aggregated_blocks - 1 - i), lo, hi);
+                            }
+
+                            X = polyval_clmul_reduce(lo, hi);
+                        }
+
+                        for (; n; --n, ++in_mm) {
+                            X = polyval_clmul_dot(_mm_xor_si128(X, _mm_loadu_si128(in_mm)), _mm_loadu_si128(powers));
+                        }
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(x.data()), X);
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_POLYVAL_CLMUL_IMPL_HPP
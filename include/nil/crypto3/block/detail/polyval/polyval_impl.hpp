@@ -0,0 +1,93 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+
+#ifndef CRYPTO3_POLYVAL_IMPL_HPP
+#define CRYPTO3_POLYVAL_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/block/detail/ghash/ghash_impl.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief Portable POLYVAL on top of the GHASH tables, using the relation from RFC 8452,
+                 * Appendix A: POLYVAL(H, X_1, ..., X_n) = ByteReverse(GHASH(mulX_GHASH(ByteReverse(H)),
+                 * ByteReverse(X_1), ..., ByteReverse(X_n))). Like ghash_impl it is not constant-time.
+                 */
+                struct polyval_impl {
+                    typedef std::array<std::uint8_t, 16> block_type;
+                    typedef ghash_impl::key_type key_type;
+
+                    static block_type reverse(const block_type &x) {
+                        block_type r;
+                        for (std::size_t i = 0; i != 16; ++i) {
+                            r[i] = x[15 - i];
+                        }
+                        return r;
+                    }
+
+                    static void schedule_key(key_type &key, const block_type &h) {
+                        block_type r = reverse(h);
+
+                        // mulX_GHASH: multiply by x in the bit-reflected GHASH representation
+                        const std::uint8_t carry = r[15] & 1;
+                        for (std::size_t i = 15; i != 0; --i) {
+                            r[i] = static_cast<std::uint8_t>((r[i] >> 1) | (r[i - 1] << 7));
+                        }
+                        r[0] = static_cast<std::uint8_t>((r[0] >> 1) ^ ((0 - carry) & 0xe1));
+
+                        ghash_impl::schedule_key(key, r);
+                        r.fill(0);
+                    }
+
+                    static void update(block_type &x, const key_type &key, const std::uint8_t *in, std::size_t n) {
+                        block_type y = reverse(x);
+                        for (; n; --n, in += 16) {
+                            for (std::size_t i = 0; i != 16; ++i) {
+                                y[i] ^= in[15 - i];
+                            }
+                            ghash_impl::multiply(y, key);
+                        }
+                        x = reverse(y);
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_POLYVAL_IMPL_HPP
@@ -91,6 +91,14 @@ namespace nil {
                     typedef typename policy_type::key_schedule_type key_schedule_type;
 
                 public:
+                    static inline void schedule_encryption_key(const key_type &key, key_schedule_type &encryption_key) {
+                        rijndael_impl<KeyBitsImpl, 128>::schedule_encryption_key(key, encryption_key);
+
+                        for (typename key_schedule_type::value_type &c : encryption_key) {
+                            boost::endian::endian_reverse_inplace(c);
+                        }
+                    }
+
                     static inline void schedule_key(const key_type &key,
                                                     key_schedule_type &encryption_key,
                                                     key_schedule_type &decryption_key) {
@@ -103,6 +111,34 @@ namespace nil {
                             boost::endian::endian_reverse_inplace(c);
                         }
                     }
+
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_encryption_key(input_keys[i], encryption_keys[i]);
+                        }
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_key(input_keys[i], encryption_keys[i], decryption_keys[i]);
+                        }
+                    }
+
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = rijndael_armv8_impl<KeyBitsImpl, 128>::encrypt_block(in[i], encryption_key);
+                        }
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = rijndael_armv8_impl<KeyBitsImpl, 128>::decrypt_block(in[i], decryption_key);
+                        }
+                    }
                 };
 
                 template<>
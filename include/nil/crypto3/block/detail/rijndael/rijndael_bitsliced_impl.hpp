@@ -0,0 +1,610 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_RIJNDAEL_BITSLICED_IMPL_HPP
+#define CRYPTO3_RIJNDAEL_BITSLICED_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/static_assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*
+                 * Bitsliced AES on 64-bit words, after the ct64 implementation from BearSSL by
+                 * Thomas Pornin. Four blocks are spread over eight words so that word i holds bit i
+                 * of every state byte; the S-box is the Boyar-Peralta circuit and all row and column
+                 * operations are shifts and masks. No memory access depends on key or data.
+                 */
+
+                inline void aes_ct64_sbox(std::uint64_t *q) {
+                    std::uint64_t x0, x1, x2, x3, x4, x5, x6, x7;
+                    std::uint64_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+                    std::uint64_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+                    std::uint64_t y20, y21;
+                    std::uint64_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+                    std::uint64_t z10, z11, z12, z13, z14, z15, z16, z17;
+                    std::uint64_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+                    std::uint64_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+                    std::uint64_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+                    std::uint64_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+                    std::uint64_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+                    std::uint64_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+                    std::uint64_t t60, t61, t62, t63, t64, t65, t66, t67;
+                    std::uint64_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+                    x0 = q[7];
+                    x1 = q[6];
+                    x2 = q[5];
+                    x3 = q[4];
+                    x4 = q[3];
+                    x5 = q[2];
+                    x6 = q[1];
+                    x7 = q[0];
+
+                    // top linear transformation
+                    y14 = x3 ^ x5;
+                    y13 = x0 ^ x6;
+                    y9 = x0 ^ x3;
+                    y8 = x0 ^ x5;
+                    t0 = x1 ^ x2;
+                    y1 = t0 ^ x7;
+                    y4 = y1 ^ x3;
+                    y12 = y13 ^ y14;
+                    y2 = y1 ^ x0;
+                    y5 = y1 ^ x6;
+                    y3 = y5 ^ y8;
+                    t1 = x4 ^ y12;
+                    y15 = t1 ^ x5;
+                    y20 = t1 ^ x1;
+                    y6 = y15 ^ x7;
+                    y10 = y15 ^ t0;
+                    y11 = y20 ^ y9;
+                    y7 = x7 ^ y11;
+                    y17 = y10 ^ y11;
+                    y19 = y10 ^ y8;
+                    y16 = t0 ^ y11;
+                    y21 = y13 ^ y16;
+                    y18 = x0 ^ y16;
+
+                    // non-linear section
+                    t2 = y12 & y15;
+                    t3 = y3 & y6;
+                    t4 = t3 ^ t2;
+                    t5 = y4 & x7;
+                    t6 = t5 ^ t2;
+                    t7 = y13 & y16;
+                    t8 = y5 & y1;
+                    t9 = t8 ^ t7;
+                    t10 = y2 & y7;
+                    t11 = t10 ^ t7;
+                    t12 = y9 & y11;
+                    t13 = y14 & y17;
+                    t14 = t13 ^ t12;
+                    t15 = y8 & y10;
+                    t16 = t15 ^ t12;
+                    t17 = t4 ^ t14;
+                    t18 = t6 ^ t16;
+                    t19 = t9 ^ t14;
+                    t20 = t11 ^ t16;
+                    t21 = t17 ^ y20;
+                    t22 = t18 ^ y19;
+                    t23 = t19 ^ y21;
+                    t24 = t20 ^ y18;
+
+                    t25 = t21 ^ t22;
+                    t26 = t21 & t23;
+                    t27 = t24 ^ t26;
+                    t28 = t25 & t27;
+                    t29 = t28 ^ t22;
+                    t30 = t23 ^ t24;
+                    t31 = t22 ^ t26;
+                    t32 = t31 & t30;
+                    t33 = t32 ^ t24;
+                    t34 = t23 ^ t33;
+                    t35 = t27 ^ t33;
+                    t36 = t24 & t35;
+                    t37 = t36 ^ t34;
+                    t38 = t27 ^ t36;
+                    t39 = t29 & t38;
+                    t40 = t25 ^ t39;
+
+                    t41 = t40 ^ t37;
+                    t42 = t29 ^ t33;
+                    t43 = t29 ^ t40;
+                    t44 = t33 ^ t37;
+                    t45 = t42 ^ t41;
+                    z0 = t44 & y15;
+                    z1 = t37 & y6;
+                    z2 = t33 & x7;
+                    z3 = t43 & y16;
+                    z4 = t40 & y1;
+                    z5 = t29 & y7;
+                    z6 = t42 & y11;
+                    z7 = t45 & y17;
+                    z8 = t41 & y10;
+                    z9 = t44 & y12;
+                    z10 = t37 & y3;
+                    z11 = t33 & y4;
+                    z12 = t43 & y13;
+                    z13 = t40 & y5;
+                    z14 = t29 & y2;
+                    z15 = t42 & y9;
+                    z16 = t45 & y14;
+                    z17 = t41 & y8;
+
+                    // bottom linear transformation
+                    t46 = z15 ^ z16;
+                    t47 = z10 ^ z11;
+                    t48 = z5 ^ z13;
+                    t49 = z9 ^ z10;
+                    t50 = z2 ^ z12;
+                    t51 = z2 ^ z5;
+                    t52 = z7 ^ z8;
+                    t53 = z0 ^ z3;
+                    t54 = z6 ^ z7;
+                    t55 = z16 ^ z17;
+                    t56 = z12 ^ t48;
+                    t57 = t50 ^ t53;
+                    t58 = z4 ^ t46;
+                    t59 = z3 ^ t54;
+                    t60 = t46 ^ t57;
+                    t61 = z14 ^ t57;
+                    t62 = t52 ^ t58;
+                    t63 = t49 ^ t58;
+                    t64 = z4 ^ t59;
+                    t65 = t61 ^ t62;
+                    t66 = z1 ^ t63;
+                    s0 = t59 ^ t63;
+                    s6 = t56 ^ ~t62;
+                    s7 = t48 ^ ~t60;
+                    t67 = t64 ^ t65;
+                    s3 = t53 ^ t66;
+                    s4 = t51 ^ t66;
+                    s5 = t47 ^ t65;
+                    s1 = t64 ^ ~s3;
+                    s2 = t55 ^ ~t67;
+
+                    q[7] = s0;
+                    q[6] = s1;
+                    q[5] = s2;
+                    q[4] = s3;
+                    q[3] = s4;
+                    q[2] = s5;
+                    q[1] = s6;
+                    q[0] = s7;
+                }
+
+                // The inverse S-box is the forward one wrapped in the inverse affine transform
+                inline void aes_ct64_inv_affine(std::uint64_t *q) {
+                    const std::uint64_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3], q4 = q[4], q5 = ~q[5],
+                                        q6 = ~q[6], q7 = q[7];
+
+                    q[7] = q1 ^ q4 ^ q6;
+                    q[6] = q0 ^ q3 ^ q5;
+                    q[5] = q7 ^ q2 ^ q4;
+                    q[4] = q6 ^ q1 ^ q3;
+                    q[3] = q5 ^ q0 ^ q2;
+                    q[2] = q4 ^ q7 ^ q1;
+                    q[1] = q3 ^ q6 ^ q0;
+                    q[0] = q2 ^ q5 ^ q7;
+                }
+
+                inline void aes_ct64_inv_sbox(std::uint64_t *q) {
+                    aes_ct64_inv_affine(q);
+                    aes_ct64_sbox(q);
+                    aes_ct64_inv_affine(q);
+                }
+
+                // Transposes between the byte-interleaved and the bitsliced representation (an involution)
+                inline void aes_ct64_ortho(std::uint64_t *q) {
+#define AES_CT64_SWAPN(CL, CH, S, X, Y)                     \
+    do {                                                    \
+        const std::uint64_t a = (X), b = (Y);               \
+        (X) = (a & (CL)) | ((b & (CL)) << (S));             \
+        (Y) = ((a & (CH)) >> (S)) | (b & (CH));             \
+    } while (0)
+
+#define AES_CT64_SWAP2(X, Y) AES_CT64_SWAPN(0x5555555555555555ULL, 0xAAAAAAAAAAAAAAAAULL, 1, X, Y)
+#define AES_CT64_SWAP4(X, Y) AES_CT64_SWAPN(0x3333333333333333ULL, 0xCCCCCCCCCCCCCCCCULL, 2, X, Y)
+#define AES_CT64_SWAP8(X, Y) AES_CT64_SWAPN(0x0F0F0F0F0F0F0F0FULL, 0xF0F0F0F0F0F0F0F0ULL, 4, X, Y)
+
+                    AES_CT64_SWAP2(q[0], q[1]);
+                    AES_CT64_SWAP2(q[2], q[3]);
+                    AES_CT64_SWAP2(q[4], q[5]);
+                    AES_CT64_SWAP2(q[6], q[7]);
+
+                    AES_CT64_SWAP4(q[0], q[2]);
+                    AES_CT64_SWAP4(q[1], q[3]);
+                    AES_CT64_SWAP4(q[4], q[6]);
+                    AES_CT64_SWAP4(q[5], q[7]);
+
+                    AES_CT64_SWAP8(q[0], q[4]);
+                    AES_CT64_SWAP8(q[1], q[5]);
+                    AES_CT64_SWAP8(q[2], q[6]);
+                    AES_CT64_SWAP8(q[3], q[7]);
+
+#undef AES_CT64_SWAP8
+#undef AES_CT64_SWAP4
+#undef AES_CT64_SWAP2
+#undef AES_CT64_SWAPN
+                }
+
+                // Spreads four little-endian state words over two 64-bit words, 16 bits apart
+                inline void aes_ct64_interleave_in(std::uint64_t &q0, std::uint64_t &q1, const std::uint32_t *w) {
+                    std::uint64_t x0 = w[0], x1 = w[1], x2 = w[2], x3 = w[3];
+
+                    x0 = (x0 | (x0 << 16)) & 0x0000FFFF0000FFFFULL;
+                    x1 = (x1 | (x1 << 16)) & 0x0000FFFF0000FFFFULL;
+                    x2 = (x2 | (x2 << 16)) & 0x0000FFFF0000FFFFULL;
+                    x3 = (x3 | (x3 << 16)) & 0x0000FFFF0000FFFFULL;
+                    x0 = (x0 | (x0 << 8)) & 0x00FF00FF00FF00FFULL;
+                    x1 = (x1 | (x1 << 8)) & 0x00FF00FF00FF00FFULL;
+                    x2 = (x2 | (x2 << 8)) & 0x00FF00FF00FF00FFULL;
+                    x3 = (x3 | (x3 << 8)) & 0x00FF00FF00FF00FFULL;
+
+                    q0 = x0 | (x2 << 8);
+                    q1 = x1 | (x3 << 8);
+                }
+
+                inline void aes_ct64_interleave_out(std::uint32_t *w, std::uint64_t q0, std::uint64_t q1) {
+                    std::uint64_t x0 = q0 & 0x00FF00FF00FF00FFULL, x1 = q1 & 0x00FF00FF00FF00FFULL,
+                                  x2 = (q0 >> 8) & 0x00FF00FF00FF00FFULL, x3 = (q1 >> 8) & 0x00FF00FF00FF00FFULL;
+
+                    x0 = (x0 | (x0 >> 8)) & 0x0000FFFF0000FFFFULL;
+                    x1 = (x1 | (x1 >> 8)) & 0x0000FFFF0000FFFFULL;
+                    x2 = (x2 | (x2 >> 8)) & 0x0000FFFF0000FFFFULL;
+                    x3 = (x3 | (x3 >> 8)) & 0x0000FFFF0000FFFFULL;
+
+                    w[0] = static_cast<std::uint32_t>(x0) | static_cast<std::uint32_t>(x0 >> 16);
+                    w[1] = static_cast<std::uint32_t>(x1) | static_cast<std::uint32_t>(x1 >> 16);
+                    w[2] = static_cast<std::uint32_t>(x2) | static_cast<std::uint32_t>(x2 >> 16);
+                    w[3] = static_cast<std::uint32_t>(x3) | static_cast<std::uint32_t>(x3 >> 16);
+                }
+
+                inline void aes_ct64_add_round_key(std::uint64_t *q, const std::uint64_t *sk) {
+                    for (std::size_t i = 0; i != 8; ++i) {
+                        q[i] ^= sk[i];
+                    }
+                }
+
+                inline void aes_ct64_shift_rows(std::uint64_t *q) {
+                    for (std::size_t i = 0; i != 8; ++i) {
+                        const std::uint64_t x = q[i];
+                        q[i] = (x & 0x000000000000FFFFULL) | ((x & 0x00000000FFF00000ULL) >> 4) |
+                               ((x & 0x00000000000F0000ULL) << 12) | ((x & 0x0000FF0000000000ULL) >> 8) |
+                               ((x & 0x000000FF00000000ULL) << 8) | ((x & 0xF000000000000000ULL) >> 12) |
+                               ((x & 0x0FFF000000000000ULL) << 4);
+                    }
+                }
+
+                inline void aes_ct64_inv_shift_rows(std::uint64_t *q) {
+                    for (std::size_t i = 0; i != 8; ++i) {
+                        const std::uint64_t x = q[i];
+                        q[i] = (x & 0x000000000000FFFFULL) | ((x & 0x000000000FFF0000ULL) << 4) |
+                               ((x & 0x00000000F0000000ULL) >> 12) | ((x & 0x000000FF00000000ULL) << 8) |
+                               ((x & 0x0000FF0000000000ULL) >> 8) | ((x & 0x000F000000000000ULL) << 12) |
+                               ((x & 0xFFF0000000000000ULL) >> 4);
+                    }
+                }
+
+                inline std::uint64_t aes_ct64_rotr32(std::uint64_t x) {
+                    return (x << 32) | (x >> 32);
+                }
+
+                inline void aes_ct64_mix_columns(std::uint64_t *q) {
+                    const std::uint64_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3], q4 = q[4], q5 = q[5],
+                                        q6 = q[6], q7 = q[7];
+                    const std::uint64_t r0 = (q0 >> 16) | (q0 << 48), r1 = (q1 >> 16) | (q1 << 48),
+                                        r2 = (q2 >> 16) | (q2 << 48), r3 = (q3 >> 16) | (q3 << 48),
+                                        r4 = (q4 >> 16) | (q4 << 48), r5 = (q5 >> 16) | (q5 << 48),
+                                        r6 = (q6 >> 16) | (q6 << 48), r7 = (q7 >> 16) | (q7 << 48);
+
+                    q[0] = q7 ^ r7 ^ r0 ^ aes_ct64_rotr32(q0 ^ r0);
+                    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ aes_ct64_rotr32(q1 ^ r1);
+                    q[2] = q1 ^ r1 ^ r2 ^ aes_ct64_rotr32(q2 ^ r2);
+                    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ aes_ct64_rotr32(q3 ^ r3);
+                    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ aes_ct64_rotr32(q4 ^ r4);
+                    q[5] = q4 ^ r4 ^ r5 ^ aes_ct64_rotr32(q5 ^ r5);
+                    q[6] = q5 ^ r5 ^ r6 ^ aes_ct64_rotr32(q6 ^ r6);
+                    q[7] = q6 ^ r6 ^ r7 ^ aes_ct64_rotr32(q7 ^ r7);
+                }
+
+                inline void aes_ct64_inv_mix_columns(std::uint64_t *q) {
+                    const std::uint64_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3], q4 = q[4], q5 = q[5],
+                                        q6 = q[6], q7 = q[7];
+                    const std::uint64_t r0 = (q0 >> 16) | (q0 << 48), r1 = (q1 >> 16) | (q1 << 48),
+                                        r2 = (q2 >> 16) | (q2 << 48), r3 = (q3 >> 16) | (q3 << 48),
+                                        r4 = (q4 >> 16) | (q4 << 48), r5 = (q5 >> 16) | (q5 << 48),
+                                        r6 = (q6 >> 16) | (q6 << 48), r7 = (q7 >> 16) | (q7 << 48);
+
+                    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ aes_ct64_rotr32(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+                    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ aes_ct64_rotr32(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+                    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ aes_ct64_rotr32(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+                    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^
+                           aes_ct64_rotr32(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+                    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^
+                           aes_ct64_rotr32(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+                    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^
+                           aes_ct64_rotr32(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+                    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^ aes_ct64_rotr32(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+                    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ aes_ct64_rotr32(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+                }
+
+                inline std::uint32_t aes_ct64_sub_word(std::uint32_t x) {
+                    std::uint64_t q[8] = {x, 0, 0, 0, 0, 0, 0, 0};
+
+                    aes_ct64_ortho(q);
+                    aes_ct64_sbox(q);
+                    aes_ct64_ortho(q);
+
+                    return static_cast<std::uint32_t>(q[0]);
+                }
+
+                template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl>
+                class rijndael_bitsliced_impl {
+                    typedef rijndael_policy<KeyBitsImpl, BlockBitsImpl> policy_type;
+
+                    typedef typename policy_type::key_type key_type;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+                    typedef typename policy_type::block_type block_type;
+
+                    BOOST_STATIC_ASSERT(BlockBitsImpl == 128 && BlockBitsImpl == policy_type::block_bits);
+
+                    constexpr static const std::size_t rounds = policy_type::rounds;
+                    constexpr static const std::size_t parallel_blocks = 4;
+
+                    /*
+                     * The schedule keeps the round keys compressed, two words per round, which is
+                     * exactly the size of key_schedule_type. They are expanded to eight words per
+                     * round on every call.
+                     */
+                    typedef std::array<std::uint64_t, 8 * (rounds + 1)> expanded_key_type;
+
+                    static void expand_key(expanded_key_type &skey, const key_schedule_type &key_schedule) {
+                        for (std::size_t u = 0; u != 2 * (rounds + 1); ++u) {
+                            const std::uint64_t x = static_cast<std::uint64_t>(key_schedule[2 * u]) |
+                                                    static_cast<std::uint64_t>(key_schedule[2 * u + 1]) << 32;
+
+                            const std::uint64_t x0 = x & 0x1111111111111111ULL;
+                            const std::uint64_t x1 = (x & 0x2222222222222222ULL) >> 1;
+                            const std::uint64_t x2 = (x & 0x4444444444444444ULL) >> 2;
+                            const std::uint64_t x3 = (x & 0x8888888888888888ULL) >> 3;
+
+                            skey[4 * u + 0] = (x0 << 4) - x0;
+                            skey[4 * u + 1] = (x1 << 4) - x1;
+                            skey[4 * u + 2] = (x2 << 4) - x2;
+                            skey[4 * u + 3] = (x3 << 4) - x3;
+                        }
+                    }
+
+                    static void load(std::uint64_t *q, const block_type *in, std::size_t n) {
+                        std::uint32_t w[4 * parallel_blocks] = {0};
+                        for (std::size_t i = 0; i != n; ++i) {
+                            for (std::size_t j = 0; j != 4; ++j) {
+                                w[4 * i + j] = static_cast<std::uint32_t>(in[i][4 * j]) |
+                                               static_cast<std::uint32_t>(in[i][4 * j + 1]) << 8 |
+                                               static_cast<std::uint32_t>(in[i][4 * j + 2]) << 16 |
+                                               static_cast<std::uint32_t>(in[i][4 * j + 3]) << 24;
+                            }
+                        }
+
+                        for (std::size_t i = 0; i != parallel_blocks; ++i) {
+                            aes_ct64_interleave_in(q[i], q[i + 4], w + 4 * i);
+                        }
+                        aes_ct64_ortho(q);
+                    }
+
+                    static void store(block_type *out, std::uint64_t *q, std::size_t n) {
+                        std::uint32_t w[4 * parallel_blocks];
+
+                        aes_ct64_ortho(q);
+                        for (std::size_t i = 0; i != parallel_blocks; ++i) {
+                            aes_ct64_interleave_out(w + 4 * i, q[i], q[i + 4]);
+                        }
+
+                        for (std::size_t i = 0; i != n; ++i) {
+                            for (std::size_t j = 0; j != 4; ++j) {
+                                out[i][4 * j] = static_cast<std::uint8_t>(w[4 * i + j]);
+                                out[i][4 * j + 1] = static_cast<std::uint8_t>(w[4 * i + j] >> 8);
+                                out[i][4 * j + 2] = static_cast<std::uint8_t>(w[4 * i + j] >> 16);
+                                out[i][4 * j + 3] = static_cast<std::uint8_t>(w[4 * i + j] >> 24);
+                            }
+                        }
+                    }
+
+                    static void encrypt_state(std::uint64_t *q, const expanded_key_type &skey) {
+                        aes_ct64_add_round_key(q, skey.data());
+                        for (std::size_t u = 1; u != rounds; ++u) {
+                            aes_ct64_sbox(q);
+                            aes_ct64_shift_rows(q);
+                            aes_ct64_mix_columns(q);
+                            aes_ct64_add_round_key(q, skey.data() + 8 * u);
+                        }
+                        aes_ct64_sbox(q);
+                        aes_ct64_shift_rows(q);
+                        aes_ct64_add_round_key(q, skey.data() + 8 * rounds);
+                    }
+
+                    static void decrypt_state(std::uint64_t *q, const expanded_key_type &skey) {
+                        aes_ct64_add_round_key(q, skey.data() + 8 * rounds);
+                        for (std::size_t u = rounds - 1; u != 0; --u) {
+                            aes_ct64_inv_shift_rows(q);
+                            aes_ct64_inv_sbox(q);
+                            aes_ct64_add_round_key(q, skey.data() + 8 * u);
+                            aes_ct64_inv_mix_columns(q);
+                        }
+                        aes_ct64_inv_shift_rows(q);
+                        aes_ct64_inv_sbox(q);
+                        aes_ct64_add_round_key(q, skey.data());
+                    }
+
+                public:
+                    static block_type encrypt_block(const block_type &plaintext,
+                                                    const key_schedule_type &encryption_key) {
+                        block_type out;
+                        encrypt_blocks(&plaintext, &out, 1, encryption_key);
+                        return out;
+                    }
+
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        expanded_key_type skey;
+                        expand_key(skey, encryption_key);
+
+                        while (n) {
+                            const std::size_t chunk = n < parallel_blocks ? n : parallel_blocks;
+                            std::uint64_t q[8];
+
+                            load(q, in, chunk);
+                            encrypt_state(q, skey);
+                            store(out, q, chunk);
+
+                            in += chunk;
+                            out += chunk;
+                            n -= chunk;
+                        }
+
+                        skey.fill(0);
+                    }
+
+                    static block_type decrypt_block(const block_type &ciphertext,
+                                                    const key_schedule_type &decryption_key) {
+                        block_type out;
+                        decrypt_blocks(&ciphertext, &out, 1, decryption_key);
+                        return out;
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        expanded_key_type skey;
+                        expand_key(skey, decryption_key);
+
+                        while (n) {
+                            const std::size_t chunk = n < parallel_blocks ? n : parallel_blocks;
+                            std::uint64_t q[8];
+
+                            load(q, in, chunk);
+                            decrypt_state(q, skey);
+                            store(out, q, chunk);
+
+                            in += chunk;
+                            out += chunk;
+                            n -= chunk;
+                        }
+
+                        skey.fill(0);
+                    }
+
+                    static void schedule_encryption_key(const key_type &input_key, key_schedule_type &encryption_key) {
+                        constexpr static const std::size_t nk = policy_type::key_words;
+                        constexpr static const std::size_t nkf = 4 * (rounds + 1);
+
+                        std::array<std::uint32_t, nkf> w;
+                        for (std::size_t i = 0; i != nk; ++i) {
+                            w[i] = static_cast<std::uint32_t>(input_key[4 * i]) |
+                                   static_cast<std::uint32_t>(input_key[4 * i + 1]) << 8 |
+                                   static_cast<std::uint32_t>(input_key[4 * i + 2]) << 16 |
+                                   static_cast<std::uint32_t>(input_key[4 * i + 3]) << 24;
+                        }
+
+                        std::uint32_t tmp = w[nk - 1];
+                        for (std::size_t i = nk, j = 0, k = 0; i != nkf; ++i) {
+                            if (j == 0) {
+                                tmp = (tmp << 24) | (tmp >> 8);
+                                tmp = aes_ct64_sub_word(tmp) ^ policy_type::round_constants[k];
+                            } else if (nk > 6 && j == 4) {
+                                tmp = aes_ct64_sub_word(tmp);
+                            }
+                            tmp ^= w[i - nk];
+                            w[i] = tmp;
+                            if (++j == nk) {
+                                j = 0;
+                                ++k;
+                            }
+                        }
+
+                        for (std::size_t i = 0, j = 0; i != nkf; i += 4, j += 4) {
+                            std::uint64_t q[8];
+
+                            aes_ct64_interleave_in(q[0], q[4], w.data() + i);
+                            q[1] = q[2] = q[3] = q[0];
+                            q[5] = q[6] = q[7] = q[4];
+                            aes_ct64_ortho(q);
+
+                            const std::uint64_t lo = (q[0] & 0x1111111111111111ULL) | (q[1] & 0x2222222222222222ULL) |
+                                                     (q[2] & 0x4444444444444444ULL) | (q[3] & 0x8888888888888888ULL);
+                            const std::uint64_t hi = (q[4] & 0x1111111111111111ULL) | (q[5] & 0x2222222222222222ULL) |
+                                                     (q[6] & 0x4444444444444444ULL) | (q[7] & 0x8888888888888888ULL);
+
+                            encryption_key[j] = static_cast<std::uint32_t>(lo);
+                            encryption_key[j + 1] = static_cast<std::uint32_t>(lo >> 32);
+                            encryption_key[j + 2] = static_cast<std::uint32_t>(hi);
+                            encryption_key[j + 3] = static_cast<std::uint32_t>(hi >> 32);
+                        }
+
+                        w.fill(0);
+                    }
+
+                    /*!
+                     * @brief Bitsliced decryption runs the inverse rounds with the encryption round
+                     * keys, so both schedules hold the same compressed keys.
+                     */
+                    static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
+                                             key_schedule_type &decryption_key) {
+                        schedule_encryption_key(input_key, encryption_key);
+                        decryption_key = encryption_key;
+                    }
+
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_encryption_key(input_keys[i], encryption_keys[i]);
+                        }
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_key(input_keys[i], encryption_keys[i], decryption_keys[i]);
+                        }
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_RIJNDAEL_BITSLICED_IMPL_HPP
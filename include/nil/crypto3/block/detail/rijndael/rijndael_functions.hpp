@@ -84,7 +84,7 @@ namespace nil {
                         41,  123, 141, 140, 143, 138, 133, 148, 167, 242, 13,  23,  57,  75,  221, 124, 132, 151, 162,
                         253, 28,  36,  108, 180, 199, 82,  246, 1};
 
-                    inline static byte_type mul(byte_type x, byte_type y) {
+                    constexpr static byte_type mul(byte_type x, byte_type y) {
                         if (x && y) {
                             return pow_[(log_[x] + log_[y]) % 255];
                         } else {
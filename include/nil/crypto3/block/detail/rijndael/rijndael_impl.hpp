@@ -25,10 +25,12 @@
 #ifndef CRYPTO3_RIJNDAEL_IMPL_HPP
 #define CRYPTO3_RIJNDAEL_IMPL_HPP
 
-#include <nil/crypto3/block/algorithm/move.hpp>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <utility>
 
-#include <nil/crypto3/detail/stream_endian.hpp>
-#include <nil/crypto3/detail/pack.hpp>
+#include <nil/crypto3/block/detail/rijndael/rijndael_policy.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -37,6 +39,12 @@ namespace nil {
              * @cond DETAIL_IMPL
              */
             namespace detail {
+                /*!
+                 * @brief Portable byte-oriented Rijndael. Every step is written as a function returning
+                 * a new value, so that key expansion and block encryption and decryption can also run
+                 * in constant expressions, e.g. to static_assert known answers or to derive fixed-key
+                 * tables at compile time.
+                 */
                 template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl>
                 class rijndael_impl {
                     typedef rijndael_policy<KeyBitsImpl, BlockBitsImpl> policy_type;
@@ -45,178 +53,220 @@ namespace nil {
                     typedef typename policy_type::key_schedule_type key_schedule_type;
                     typedef typename policy_type::key_schedule_word_type key_schedule_word_type;
 
+                    typedef typename policy_type::byte_type byte_type;
                     typedef typename policy_type::block_type block_type;
 
                     typedef typename policy_type::constants_type constants_type;
                     typedef typename policy_type::shift_offsets_type shift_offsets_type;
                     typedef typename policy_type::mm_type mm_type;
 
+                    typedef std::make_index_sequence<policy_type::block_bytes> block_indices;
+                    typedef std::make_index_sequence<policy_type::key_schedule_words> key_schedule_indices;
+
                     BOOST_STATIC_ASSERT(KeyBitsImpl == policy_type::key_bits);
                     BOOST_STATIC_ASSERT(BlockBitsImpl == policy_type::block_bits);
 
-                    static inline key_schedule_word_type sub_word(const key_schedule_word_type &x,
-                                                                  const constants_type &constants) {
-                        key_schedule_word_type result = {0};
+                    // Schedule words hold the first state byte of their column in the lowest octet
+
+                    static constexpr byte_type word_byte(key_schedule_word_type x, std::size_t i) {
+                        return static_cast<byte_type>(x >> (i * CHAR_BIT));
+                    }
+
+                    static constexpr key_schedule_word_type sub_word(key_schedule_word_type x,
+                                                                     const constants_type &constants) {
+                        key_schedule_word_type result = 0;
 
                         for (std::size_t i = 0; i < policy_type::word_bytes; ++i) {
-                            result =
-                                result << CHAR_BIT | constants[::nil::crypto3::detail::extract_uint_t<CHAR_BIT>(x, i)];
+                            result |= key_schedule_word_type(constants[word_byte(x, i)]) << (i * CHAR_BIT);
                         }
 
                         return result;
                     }
 
-                    static inline void sub_bytes(block_type &state, const constants_type &sbox) {
-
-                        for (std::size_t i = 0; i < policy_type::word_bytes * policy_type::block_words; ++i) {
-                            state[i] = sbox[state[i]];
-                        }
+                    static constexpr key_schedule_word_type rotate_word(key_schedule_word_type x) {
+                        return (x >> CHAR_BIT) | (x << (policy_type::word_bits - CHAR_BIT));
                     }
 
-                    static inline void shift_rows(block_type &state, const shift_offsets_type &offset) {
-                        std::array<typename policy_type::byte_type, policy_type::block_words> tmp = {0};
+                    static constexpr key_schedule_word_type mix_column(key_schedule_word_type x, const mm_type &mm) {
+                        key_schedule_word_type result = 0;
 
-                        // row 0 never gets shifted
+                        for (std::size_t row = 0; row < policy_type::word_bytes; ++row) {
+                            byte_type b = 0;
+                            for (std::size_t k = 0; k < policy_type::word_bytes; ++k) {
+                                b ^= policy_type::mul(mm[row * policy_type::word_bytes + k], word_byte(x, k));
+                            }
+                            result |= key_schedule_word_type(b) << (row * CHAR_BIT);
+                        }
 
-                        for (std::size_t row = 1; row < policy_type::word_bytes; ++row) {
-                            const std::size_t off = offset[row - 1];
+                        return result;
+                    }
 
-                            for (std::size_t i = 0; i < off; ++i) {
-                                tmp[i] = state[i * policy_type::word_bytes + row];
-                            }
+                    /*!
+                     * @brief Index of the state byte that ShiftRows moves to position i; row 0 never
+                     * gets shifted.
+                     */
+                    static constexpr std::size_t shifted_index(std::size_t i, const shift_offsets_type &offsets) {
+                        const std::size_t row = i % policy_type::word_bytes;
+                        const std::size_t col =
+                            (i / policy_type::word_bytes + (row ? offsets[row - 1] : 0)) % policy_type::block_words;
 
-                            for (std::size_t i = 0; i < policy_type::block_words - 1; ++i) {
-                                state[i * policy_type::word_bytes + row] =
-                                    state[(i + off) * policy_type::word_bytes + row];
-                            }
+                        return col * policy_type::word_bytes + row;
+                    }
 
-                            for (std::size_t i = 0; i < off; ++i) {
-                                state[(policy_type::block_words - 1 - i) * policy_type::word_bytes + row] =
-                                    tmp[off - 1 - i];
-                            }
-                        }
+                    static constexpr byte_type round_key_byte(const key_schedule_type &w, std::size_t round,
+                                                              std::size_t i) {
+                        return word_byte(w[round * policy_type::block_words + i / policy_type::word_bytes],
+                                         i % policy_type::word_bytes);
                     }
 
-                    template<typename StateType>
-                    static inline block_type mix_columns(const StateType &state, const mm_type &mm) {
-                        block_type tmp = {0};
+                    /*!
+                     * @brief Byte i of the state after SubBytes, ShiftRows, MixColumns (unless this is
+                     * the last round) and AddRoundKey.
+                     */
+                    static constexpr byte_type round_byte(const block_type &state, const key_schedule_type &w,
+                                                          std::size_t round, const constants_type &sbox,
+                                                          const shift_offsets_type &offsets, const mm_type &mm,
+                                                          bool last, std::size_t i) {
+                        byte_type result = round_key_byte(w, round, i);
+
+                        if (last) {
+                            return static_cast<byte_type>(result ^ sbox[state[shifted_index(i, offsets)]]);
+                        }
 
-                        for (std::size_t col = 0; col < policy_type::block_words; ++col) {
+                        const std::size_t col = i / policy_type::word_bytes, row = i % policy_type::word_bytes;
+                        for (std::size_t k = 0; k < policy_type::word_bytes; ++k) {
+                            result ^= policy_type::mul(
+                                mm[row * policy_type::word_bytes + k],
+                                sbox[state[shifted_index(col * policy_type::word_bytes + k, offsets)]]);
+                        }
 
-                            for (std::size_t row = 0; row < policy_type::word_bytes; ++row) {
+                        return result;
+                    }
 
-                                for (std::size_t k = 0; k < policy_type::word_bytes; ++k) {
-                                    tmp[col * policy_type::word_bytes + row] ^=
-                                        policy_type::mul(mm[row * policy_type::word_bytes + k],
-                                                         state[col * policy_type::word_bytes + k]);
-                                }
-                            }
-                        }
+                    template<std::size_t... I>
+                    static constexpr block_type apply_round(const block_type &state, const key_schedule_type &w,
+                                                            std::size_t round, const constants_type &sbox,
+                                                            const shift_offsets_type &offsets, const mm_type &mm,
+                                                            bool last, std::index_sequence<I...>) {
+                        return {{round_byte(state, w, round, sbox, offsets, mm, last, I)...}};
+                    }
 
-                        return tmp;
+                    template<std::size_t... I>
+                    static constexpr block_type add_round_key(const block_type &state, const key_schedule_type &w,
+                                                              std::size_t round, std::index_sequence<I...>) {
+                        return {{static_cast<byte_type>(state[I] ^ round_key_byte(w, round, I))...}};
                     }
 
-                    template<typename InputIterator>
-                    static inline void add_round_key(block_type &state, InputIterator first, InputIterator last) {
-                        BOOST_ASSERT(std::distance(first, last) == policy_type::block_words &&
-                                     state.size() == policy_type::block_bytes);
+                    template<std::size_t... I>
+                    static constexpr key_schedule_type
+                        make_schedule(const key_schedule_word_type (&w)[policy_type::key_schedule_words],
+                                      std::index_sequence<I...>) {
+                        return {{w[I]...}};
+                    }
 
-                        for (std::size_t i = 0; i < policy_type::block_words && first != last; ++i && ++first) {
+                    // The first and the last round keys are used as they are by the equivalent inverse cipher
+                    template<std::size_t... I>
+                    static constexpr key_schedule_type invert_schedule(const key_schedule_type &encryption_key,
+                                                                       std::index_sequence<I...>) {
+                        return {{(I < policy_type::block_words || I >= policy_type::rounds * policy_type::block_words ?
+                                      encryption_key[I] :
+                                      mix_column(encryption_key[I], policy_type::inverted_mm))...}};
+                    }
 
+                public:
+                    static constexpr key_schedule_type encryption_schedule(const key_type &key) {
+                        key_schedule_word_type w[policy_type::key_schedule_words] = {};
+
+                        // the first key_words words are the original key
+                        for (std::size_t i = 0; i < policy_type::key_words; ++i) {
                             for (std::size_t j = 0; j < policy_type::word_bytes; ++j) {
-                                state[i * policy_type::word_bytes + j] ^=
-                                    ::nil::crypto3::detail::extract_uint_t<CHAR_BIT>(*first,
-                                                                                     policy_type::word_bytes - (j + 1));
+                                w[i] |= key_schedule_word_type(key[i * policy_type::word_bytes + j]) << (j * CHAR_BIT);
                             }
                         }
-                    }
 
-                    static inline void apply_round(std::uint8_t round, block_type &state, const key_schedule_type &w,
-                                                   const constants_type &sbox, const shift_offsets_type &offsets,
-                                                   const mm_type &mm) {
-                        sub_bytes(state, sbox);
-                        shift_rows(state, offsets);
-                        state = mix_columns(state, mm);
-                        add_round_key(state, w.begin() + round * policy_type::block_words,
-                                      w.begin() + (round + 1) * policy_type::block_words);
+                        for (std::size_t i = policy_type::key_words; i < policy_type::key_schedule_words; ++i) {
+                            key_schedule_word_type tmp = w[i - 1];
+                            if (i % policy_type::key_words == 0) {
+                                tmp = sub_word(rotate_word(tmp), policy_type::constants) ^
+                                      policy_type::round_constants[i / policy_type::key_words - 1];
+                            } else if (policy_type::key_words > 6 && i % policy_type::key_words == 4) {
+                                tmp = sub_word(tmp, policy_type::constants);
+                            }
+                            w[i] = w[i - policy_type::key_words] ^ tmp;
+                        }
+
+                        return make_schedule(w, key_schedule_indices());
                     }
 
-                public:
-                    static typename policy_type::block_type encrypt_block(const block_type &plaintext,
-                                                                          const key_schedule_type &encryption_key) {
-                        block_type state = plaintext;
+                    static constexpr key_schedule_type decryption_schedule(const key_schedule_type &encryption_key) {
+                        return invert_schedule(encryption_key, key_schedule_indices());
+                    }
 
-                        add_round_key(state, encryption_key.begin(), encryption_key.begin() + policy_type::block_words);
+                    static constexpr block_type encrypt_block(const block_type &plaintext,
+                                                              const key_schedule_type &encryption_key) {
+                        block_type state = add_round_key(plaintext, encryption_key, 0, block_indices());
 
                         for (std::size_t round = 1; round < policy_type::rounds; ++round) {
-                            apply_round(round, state, encryption_key, policy_type::constants,
-                                        policy_type::shift_offsets, policy_type::mm);
+                            state = apply_round(state, encryption_key, round, policy_type::constants,
+                                                policy_type::shift_offsets, policy_type::mm, false, block_indices());
                         }
 
-                        sub_bytes(state, policy_type::constants);
-                        shift_rows(state, policy_type::shift_offsets);
-                        add_round_key(state, encryption_key.begin() + policy_type::rounds * policy_type::block_words,
-                                      encryption_key.begin() + (policy_type::rounds + 1) * policy_type::block_words);
-
-                        return state;
+                        return apply_round(state, encryption_key, policy_type::rounds, policy_type::constants,
+                                           policy_type::shift_offsets, policy_type::mm, true, block_indices());
                     }
 
-                    static typename policy_type::block_type decrypt_block(const block_type &plaintext,
-                                                                          const key_schedule_type &decryption_key) {
-                        block_type state = plaintext;
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = encrypt_block(in[i], encryption_key);
+                        }
+                    }
 
-                        add_round_key(state, decryption_key.begin() + policy_type::rounds * policy_type::block_words,
-                                      decryption_key.begin() + (policy_type::rounds + 1) * policy_type::block_words);
+                    static constexpr block_type decrypt_block(const block_type &ciphertext,
+                                                              const key_schedule_type &decryption_key) {
+                        block_type state =
+                            add_round_key(ciphertext, decryption_key, policy_type::rounds, block_indices());
 
                         for (std::size_t round = policy_type::rounds - 1; round > 0; --round) {
-                            apply_round(round, state, decryption_key, policy_type::inverted_constants,
-                                        policy_type::inverted_shift_offsets, policy_type::inverted_mm);
+                            state = apply_round(state, decryption_key, round, policy_type::inverted_constants,
+                                                policy_type::inverted_shift_offsets, policy_type::inverted_mm, false,
+                                                block_indices());
                         }
 
-                        sub_bytes(state, policy_type::inverted_constants);
-                        shift_rows(state, policy_type::inverted_shift_offsets);
-                        add_round_key(state, decryption_key.begin(), decryption_key.begin() + policy_type::block_words);
+                        return apply_round(state, decryption_key, 0, policy_type::inverted_constants,
+                                           policy_type::inverted_shift_offsets, policy_type::inverted_mm, true,
+                                           block_indices());
+                    }
 
-                        return state;
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = decrypt_block(in[i], decryption_key);
+                        }
+                    }
+
+                    static void schedule_encryption_key(const key_type &key, key_schedule_type &encryption_key) {
+                        encryption_key = encryption_schedule(key);
                     }
 
                     static void schedule_key(const key_type &key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-                        // the first key_words words are the original key
-                        ::nil::crypto3::detail::pack<stream_endian::big_octet_big_bit,
-                                                     stream_endian::little_octet_big_bit, CHAR_BIT,
-                                                     policy_type::word_bits>(
-                            key.begin(), key.begin() + policy_type::key_words * policy_type::word_bytes,
-                            encryption_key.begin());
+                        encryption_key = encryption_schedule(key);
+                        decryption_key = decryption_schedule(encryption_key);
+                    }
 
-                        for (std::size_t i = policy_type::key_words; i < policy_type::key_schedule_words; ++i) {
-                            typename policy_type::key_schedule_word_type tmp = encryption_key[i - 1];
-                            if (i % policy_type::key_words == 0) {
-                                tmp = sub_word(policy_type::rotate_left(tmp), policy_type::constants) ^
-                                      policy_type::round_constants[i / policy_type::key_words - 1];
-                            } else if (policy_type::key_words > 6 && i % policy_type::key_words == 4) {
-                                tmp = sub_word(tmp, policy_type::constants);
-                            }
-                            encryption_key[i] = encryption_key[i - policy_type::key_words] ^ tmp;
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_encryption_key(input_keys[i], encryption_keys[i]);
                         }
+                    }
 
-                        std::array<typename policy_type::byte_type, policy_type::key_schedule_bytes> bekey = {0};
-                        ::nil::crypto3::detail::pack<stream_endian::little_octet_big_bit,
-                                                     stream_endian::big_octet_big_bit, policy_type::word_bits,
-                                                     CHAR_BIT>(encryption_key.begin(), encryption_key.end(),
-                                                               bekey.begin());
-
-                        for (std::uint8_t round = 1; round < policy_type::rounds; ++round) {
-                            move(mix_columns(boost::adaptors::slice(bekey, round * policy_type::block_bytes,
-                                                                    (round + 1) * policy_type::block_bytes),
-                                             policy_type::inverted_mm),
-                                 bekey.begin() + round * policy_type::block_bytes);
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_key(input_keys[i], encryption_keys[i], decryption_keys[i]);
                         }
-
-                        ::nil::crypto3::detail::pack<stream_endian::big_octet_big_bit,
-                                                     stream_endian::little_octet_big_bit, CHAR_BIT,
-                                                     policy_type::word_bits>(bekey.begin(), bekey.end(),
-                                                                             decryption_key.begin());
                     }
                 };
             }    // namespace detail
@@ -27,6 +27,7 @@
 
 #include <cstddef>
 
+#include <tmmintrin.h>
 #include <wmmintrin.h>
 
 #include <nil/crypto3/detail/make_uint_t.hpp>
@@ -41,7 +42,7 @@ namespace nil {
              */
             namespace detail {
                 BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                __m128i aes_128_key_expansion(__m128i key, __m128i key_with_rcon) {
+                inline __m128i aes_128_key_expansion(__m128i key, __m128i key_with_rcon) {
                     key_with_rcon = _mm_shuffle_epi32(key_with_rcon, _MM_SHUFFLE(3, 3, 3, 3));
                     key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
                     key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
@@ -50,7 +51,7 @@ namespace nil {
                 }
 
                 BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                void aes_192_key_expansion(__m128i *K1, __m128i *K2, __m128i key2_with_rcon, uint32_t out[],
+                inline void aes_192_key_expansion(__m128i *K1, __m128i *K2, __m128i key2_with_rcon, uint32_t out[],
                                            bool last) {
                     __m128i key1 = *K1;
                     __m128i key2 = *K2;
@@ -77,17 +78,116 @@ namespace nil {
                 }
 
                 /*
-                 * The second half of the AES-256 key expansion (other half same as AES-128)
+                 * SubWord of key word Word, rotated first when Rotate is set, xored with rcon and broadcast
+                 * to all four columns: the value aeskeygenassist produces. With all columns equal ShiftRows
+                 * does nothing, so a single aesenclast computes it. aeskeygenassist is microcoded on many
+                 * cores and does not pipeline, aesenclast issues every cycle, which is what lets the
+                 * expansion of several keys overlap.
                  */
+                template<int Word, bool Rotate>
                 BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                __m128i aes_256_key_expansion(__m128i key, __m128i key2) {
-                    __m128i key_with_rcon = _mm_aeskeygenassist_si128(key2, 0x00);
-                    key_with_rcon = _mm_shuffle_epi32(key_with_rcon, _MM_SHUFFLE(2, 2, 2, 2));
+                inline __m128i aes_ni_sub_word(__m128i key, __m128i rcon) {
+                    const __m128i broadcast =
+                        Rotate ? _mm_set1_epi32((4 * Word + 1) | (4 * Word + 2) << 8 | (4 * Word + 3) << 16 |
+                                                (4 * Word) << 24) :
+                                 _mm_set1_epi32((4 * Word) | (4 * Word + 1) << 8 | (4 * Word + 2) << 16 |
+                                                (4 * Word + 3) << 24);
+                    return _mm_aesenclast_si128(_mm_shuffle_epi8(key, broadcast), rcon);
+                }
 
-                    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
-                    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
-                    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
-                    return _mm_xor_si128(key, key_with_rcon);
+                const std::uint8_t aes_ni_rcon[10] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36};
+
+                /*
+                 * Interleaved processing of several independent blocks. aesenc/aesdec have a latency of
+                 * several cycles but a throughput of one per cycle, so keeping eight blocks in flight hides it.
+                 */
+#define AES_NI_8_ROUNDS(OP, K)     \
+    do {                           \
+        B0 = OP(B0, K);            \
+        B1 = OP(B1, K);            \
+        B2 = OP(B2, K);            \
+        B3 = OP(B3, K);            \
+        B4 = OP(B4, K);            \
+        B5 = OP(B5, K);            \
+        B6 = OP(B6, K);            \
+        B7 = OP(B7, K);            \
+    } while (0)
+
+#define AES_NI_BLOCKS(ROUND, LAST_ROUND)                                              \
+    do {                                                                              \
+        __m128i K[Rounds + 1];                                                        \
+        for (std::size_t r = 0; r <= Rounds; ++r) {                                   \
+            K[r] = _mm_loadu_si128(key_mm + r);                                       \
+        }                                                                             \
+                                                                                      \
+        while (blocks >= 8) {                                                         \
+            __m128i B0 = _mm_xor_si128(_mm_loadu_si128(in_mm + 0), K[0]);             \
+            __m128i B1 = _mm_xor_si128(_mm_loadu_si128(in_mm + 1), K[0]);             \
+            __m128i B2 = _mm_xor_si128(_mm_loadu_si128(in_mm + 2), K[0]);             \
+            __m128i B3 = _mm_xor_si128(_mm_loadu_si128(in_mm + 3), K[0]);             \
+            __m128i B4 = _mm_xor_si128(_mm_loadu_si128(in_mm + 4), K[0]);             \
+            __m128i B5 = _mm_xor_si128(_mm_loadu_si128(in_mm + 5), K[0]);             \
+            __m128i B6 = _mm_xor_si128(_mm_loadu_si128(in_mm + 6), K[0]);             \
+            __m128i B7 = _mm_xor_si128(_mm_loadu_si128(in_mm + 7), K[0]);             \
+                                                                                      \
+            for (std::size_t r = 1; r != Rounds; ++r) {                               \
+                AES_NI_8_ROUNDS(ROUND, K[r]);                                         \
+            }                                                                         \
+            AES_NI_8_ROUNDS(LAST_ROUND, K[Rounds]);                                   \
+                                                                                      \
+            _mm_storeu_si128(out_mm + 0, B0);                                         \
+            _mm_storeu_si128(out_mm + 1, B1);                                         \
+            _mm_storeu_si128(out_mm + 2, B2);                                         \
+            _mm_storeu_si128(out_mm + 3, B3);                                         \
+            _mm_storeu_si128(out_mm + 4, B4);                                         \
+            _mm_storeu_si128(out_mm + 5, B5);                                         \
+            _mm_storeu_si128(out_mm + 6, B6);                                         \
+            _mm_storeu_si128(out_mm + 7, B7);                                         \
+                                                                                      \
+            in_mm += 8;                                                               \
+            out_mm += 8;                                                              \
+            blocks -= 8;                                                              \
+        }                                                                             \
+                                                                                      \
+        for (; blocks; --blocks) {                                                    \
+            __m128i B = _mm_xor_si128(_mm_loadu_si128(in_mm++), K[0]);                \
+            for (std::size_t r = 1; r != Rounds; ++r) {                               \
+                B = ROUND(B, K[r]);                                                   \
+            }                                                                         \
+            _mm_storeu_si128(out_mm++, LAST_ROUND(B, K[Rounds]));                     \
+        }                                                                             \
+    } while (0)
+
+                template<std::size_t Rounds>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline void aes_ni_encrypt_blocks(const __m128i *in_mm, __m128i *out_mm, std::size_t blocks,
+                                                  const __m128i *key_mm) {
+                    AES_NI_BLOCKS(_mm_aesenc_si128, _mm_aesenclast_si128);
+                }
+
+                template<std::size_t Rounds>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline void aes_ni_decrypt_blocks(const __m128i *in_mm, __m128i *out_mm, std::size_t blocks,
+                                                  const __m128i *key_mm) {
+                    AES_NI_BLOCKS(_mm_aesdec_si128, _mm_aesdeclast_si128);
+                }
+
+#undef AES_NI_BLOCKS
+#undef AES_NI_8_ROUNDS
+
+                /*!
+                 * @brief Derives the equivalent inverse cipher schedule from the encryption one: round
+                 * keys in reverse order, with InvMixColumns applied to all but the outer two.
+                 */
+                template<std::size_t Rounds>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline void aes_ni_inverse_schedule(const __m128i *encryption_key_mm, __m128i *decryption_key_mm) {
+                    _mm_storeu_si128(decryption_key_mm, _mm_loadu_si128(encryption_key_mm + Rounds));
+                    for (std::size_t r = 1; r != Rounds; ++r) {
+                        _mm_storeu_si128(decryption_key_mm + r,
+                                         _mm_aesimc_si128(_mm_loadu_si128(encryption_key_mm + Rounds - r)));
+                    }
+                    _mm_storeu_si128(decryption_key_mm + Rounds, _mm_loadu_si128(encryption_key_mm));
                 }
 
                 template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl>
@@ -148,6 +248,20 @@ namespace nil {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        detail::aes_ni_encrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        detail::aes_ni_decrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -189,53 +303,61 @@ namespace nil {
                         return out;
                     }
 
-                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                    static void schedule_key(const key_type &input_key,
-                                             key_schedule_type &encryption_key,
+                    /*!
+                     * @brief Expands n independent keys, Lanes at a time, so the round latency of one key
+                     * overlaps with the others.
+                     */
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (; n >= 8; n -= 8, input_keys += 8, encryption_keys += 8) {
+                            expand_encryption_keys<8>(input_keys, encryption_keys);
+                        }
+                        for (; n; --n) {
+                            expand_encryption_keys<1>(input_keys++, encryption_keys++);
+                        }
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        schedule_encryption_keys(input_keys, n, encryption_keys);
+                        for (std::size_t i = 0; i != n; ++i) {
+                            detail::aes_ni_inverse_schedule<policy_type::rounds>(
+                                reinterpret_cast<const __m128i *>(encryption_keys[i].data()),
+                                reinterpret_cast<__m128i *>(decryption_keys[i].data()));
+                        }
+                    }
+
+                    static void schedule_encryption_key(const key_type &input_key,
+                                                        key_schedule_type &encryption_key) {
+                        expand_encryption_keys<1>(&input_key, &encryption_key);
+                    }
+
+                    static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-#define AES_128_KEY_EXPANSION(K, RCON) detail::aes_128_key_expansion(K, _mm_aeskeygenassist_si128(K, RCON))
-
-                        const __m128i K0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data()));
-                        const __m128i K1 = AES_128_KEY_EXPANSION(K0, 0x01);
-                        const __m128i K2 = AES_128_KEY_EXPANSION(K1, 0x02);
-                        const __m128i K3 = AES_128_KEY_EXPANSION(K2, 0x04);
-                        const __m128i K4 = AES_128_KEY_EXPANSION(K3, 0x08);
-                        const __m128i K5 = AES_128_KEY_EXPANSION(K4, 0x10);
-                        const __m128i K6 = AES_128_KEY_EXPANSION(K5, 0x20);
-                        const __m128i K7 = AES_128_KEY_EXPANSION(K6, 0x40);
-                        const __m128i K8 = AES_128_KEY_EXPANSION(K7, 0x80);
-                        const __m128i K9 = AES_128_KEY_EXPANSION(K8, 0x1B);
-                        const __m128i K10 = AES_128_KEY_EXPANSION(K9, 0x36);
-
-#undef AES_128_KEY_EXPANSION
-
-                        __m128i *EK_mm = reinterpret_cast<__m128i *>(encryption_key.data());
-                        _mm_storeu_si128(EK_mm, K0);
-                        _mm_storeu_si128(EK_mm + 1, K1);
-                        _mm_storeu_si128(EK_mm + 2, K2);
-                        _mm_storeu_si128(EK_mm + 3, K3);
-                        _mm_storeu_si128(EK_mm + 4, K4);
-                        _mm_storeu_si128(EK_mm + 5, K5);
-                        _mm_storeu_si128(EK_mm + 6, K6);
-                        _mm_storeu_si128(EK_mm + 7, K7);
-                        _mm_storeu_si128(EK_mm + 8, K8);
-                        _mm_storeu_si128(EK_mm + 9, K9);
-                        _mm_storeu_si128(EK_mm + 10, K10);
-
-                        // Now generate decryption keys
-
-                        __m128i *DK_mm = reinterpret_cast<__m128i *>(decryption_key.data());
-                        _mm_storeu_si128(DK_mm, K10);
-                        _mm_storeu_si128(DK_mm + 1, _mm_aesimc_si128(K9));
-                        _mm_storeu_si128(DK_mm + 2, _mm_aesimc_si128(K8));
-                        _mm_storeu_si128(DK_mm + 3, _mm_aesimc_si128(K7));
-                        _mm_storeu_si128(DK_mm + 4, _mm_aesimc_si128(K6));
-                        _mm_storeu_si128(DK_mm + 5, _mm_aesimc_si128(K5));
-                        _mm_storeu_si128(DK_mm + 6, _mm_aesimc_si128(K4));
-                        _mm_storeu_si128(DK_mm + 7, _mm_aesimc_si128(K3));
-                        _mm_storeu_si128(DK_mm + 8, _mm_aesimc_si128(K2));
-                        _mm_storeu_si128(DK_mm + 9, _mm_aesimc_si128(K1));
-                        _mm_storeu_si128(DK_mm + 10, K0);
+                        schedule_encryption_key(input_key, encryption_key);
+                        detail::aes_ni_inverse_schedule<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(encryption_key.data()),
+                            reinterpret_cast<__m128i *>(decryption_key.data()));
+                    }
+
+                protected:
+                    template<std::size_t Lanes>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void expand_encryption_keys(const key_type *input_keys, key_schedule_type *encryption_keys) {
+                        __m128i K[Lanes];
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            K[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data()));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(encryption_keys[l].data()), K[l]);
+                        }
+
+                        for (std::size_t r = 1; r <= policy_type::rounds; ++r) {
+                            const __m128i rcon = _mm_set1_epi32(detail::aes_ni_rcon[r - 1]);
+                            for (std::size_t l = 0; l != Lanes; ++l) {
+                                K[l] = detail::aes_128_key_expansion(K[l],
+                                                                     detail::aes_ni_sub_word<3, true>(K[l], rcon));
+                                _mm_storeu_si128(reinterpret_cast<__m128i *>(encryption_keys[l].data()) + r, K[l]);
+                            }
+                        }
                     }
                 };
 
@@ -295,6 +417,20 @@ namespace nil {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        detail::aes_ni_encrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        detail::aes_ni_decrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -369,47 +505,63 @@ namespace nil {
                         }
                     }
 
-                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                    static void schedule_key(const key_type &input_key,
-                                             key_schedule_type &encryption_key,
+                    /*!
+                     * @brief Expands n independent keys, Lanes at a time, so the round latency of one key
+                     * overlaps with the others.
+                     */
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (; n >= 8; n -= 8, input_keys += 8, encryption_keys += 8) {
+                            expand_encryption_keys<8>(input_keys, encryption_keys);
+                        }
+                        for (; n; --n) {
+                            expand_encryption_keys<1>(input_keys++, encryption_keys++);
+                        }
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        schedule_encryption_keys(input_keys, n, encryption_keys);
+                        for (std::size_t i = 0; i != n; ++i) {
+                            detail::aes_ni_inverse_schedule<policy_type::rounds>(
+                                reinterpret_cast<const __m128i *>(encryption_keys[i].data()),
+                                reinterpret_cast<__m128i *>(decryption_keys[i].data()));
+                        }
+                    }
+
+                    static void schedule_encryption_key(const key_type &input_key,
+                                                        key_schedule_type &encryption_key) {
+                        expand_encryption_keys<1>(&input_key, &encryption_key);
+                    }
+
+                    static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-                        __m128i K0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data()));
-                        __m128i K1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data() + 8));
-                        K1 = _mm_srli_si128(K1, 8);
-
-                        load_le(encryption_key.data(), input_key.data(), 6);
-
-#define AES_192_KEY_EXPANSION(RCON, EK_OFF) \
-    detail::aes_192_key_expansion(&K0, &K1, _mm_aeskeygenassist_si128(K1, RCON), &encryption_key[EK_OFF], EK_OFF == 48)
-
-                        AES_192_KEY_EXPANSION(0x01, 6);
-                        AES_192_KEY_EXPANSION(0x02, 12);
-                        AES_192_KEY_EXPANSION(0x04, 18);
-                        AES_192_KEY_EXPANSION(0x08, 24);
-                        AES_192_KEY_EXPANSION(0x10, 30);
-                        AES_192_KEY_EXPANSION(0x20, 36);
-                        AES_192_KEY_EXPANSION(0x40, 42);
-                        AES_192_KEY_EXPANSION(0x80, 48);
-
-#undef AES_192_KEY_EXPANSION
-
-                        // Now generate decryption keys
-                        const __m128i *EK_mm = reinterpret_cast<const __m128i *>(encryption_key.data());
-
-                        __m128i *DK_mm = reinterpret_cast<__m128i *>(decryption_key.data());
-                        _mm_storeu_si128(DK_mm, _mm_loadu_si128(EK_mm + 12));
-                        _mm_storeu_si128(DK_mm + 1, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 11)));
-                        _mm_storeu_si128(DK_mm + 2, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 10)));
-                        _mm_storeu_si128(DK_mm + 3, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 9)));
-                        _mm_storeu_si128(DK_mm + 4, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 8)));
-                        _mm_storeu_si128(DK_mm + 5, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 7)));
-                        _mm_storeu_si128(DK_mm + 6, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 6)));
-                        _mm_storeu_si128(DK_mm + 7, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 5)));
-                        _mm_storeu_si128(DK_mm + 8, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 4)));
-                        _mm_storeu_si128(DK_mm + 9, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 3)));
-                        _mm_storeu_si128(DK_mm + 10, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 2)));
-                        _mm_storeu_si128(DK_mm + 11, _mm_aesimc_si128(_mm_loadu_si128(EK_mm + 1)));
-                        _mm_storeu_si128(DK_mm + 12, _mm_loadu_si128(EK_mm + 0));
+                        schedule_encryption_key(input_key, encryption_key);
+                        detail::aes_ni_inverse_schedule<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(encryption_key.data()),
+                            reinterpret_cast<__m128i *>(decryption_key.data()));
+                    }
+
+                protected:
+                    template<std::size_t Lanes>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void expand_encryption_keys(const key_type *input_keys, key_schedule_type *encryption_keys) {
+                        __m128i K0[Lanes], K1[Lanes];
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            K0[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data()));
+                            K1[l] = _mm_srli_si128(
+                                _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data() + 8)), 8);
+                            load_le(encryption_keys[l].data(), input_keys[l].data(), 6);
+                        }
+
+                        for (std::size_t r = 0; r != 8; ++r) {
+                            const __m128i rcon = _mm_set1_epi32(detail::aes_ni_rcon[r]);
+                            for (std::size_t l = 0; l != Lanes; ++l) {
+                                detail::aes_192_key_expansion(&K0[l], &K1[l],
+                                                              detail::aes_ni_sub_word<1, true>(K1[l], rcon),
+                                                              &encryption_keys[l][6 * r + 6], r == 7);
+                            }
+                        }
                     }
                 };
 
@@ -473,6 +625,20 @@ namespace nil {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        detail::aes_ni_encrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        detail::aes_ni_decrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -522,67 +688,70 @@ namespace nil {
                         return out;
                     }
 
-                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
-                    static void schedule_key(const key_type &input_key,
-                                             key_schedule_type &encryption_key,
+                    /*!
+                     * @brief Expands n independent keys, Lanes at a time, so the round latency of one key
+                     * overlaps with the others.
+                     */
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (; n >= 8; n -= 8, input_keys += 8, encryption_keys += 8) {
+                            expand_encryption_keys<8>(input_keys, encryption_keys);
+                        }
+                        for (; n; --n) {
+                            expand_encryption_keys<1>(input_keys++, encryption_keys++);
+                        }
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        schedule_encryption_keys(input_keys, n, encryption_keys);
+                        for (std::size_t i = 0; i != n; ++i) {
+                            detail::aes_ni_inverse_schedule<policy_type::rounds>(
+                                reinterpret_cast<const __m128i *>(encryption_keys[i].data()),
+                                reinterpret_cast<__m128i *>(decryption_keys[i].data()));
+                        }
+                    }
+
+                    static void schedule_encryption_key(const key_type &input_key,
+                                                        key_schedule_type &encryption_key) {
+                        expand_encryption_keys<1>(&input_key, &encryption_key);
+                    }
+
+                    static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-                        const __m128i K0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data()));
-                        const __m128i K1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data() + 16));
-
-                        const __m128i K2 = detail::aes_128_key_expansion(K0, _mm_aeskeygenassist_si128(K1, 0x01));
-                        const __m128i K3 = detail::aes_256_key_expansion(K1, K2);
-
-                        const __m128i K4 = detail::aes_128_key_expansion(K2, _mm_aeskeygenassist_si128(K3, 0x02));
-                        const __m128i K5 = detail::aes_256_key_expansion(K3, K4);
-
-                        const __m128i K6 = detail::aes_128_key_expansion(K4, _mm_aeskeygenassist_si128(K5, 0x04));
-                        const __m128i K7 = detail::aes_256_key_expansion(K5, K6);
-
-                        const __m128i K8 = detail::aes_128_key_expansion(K6, _mm_aeskeygenassist_si128(K7, 0x08));
-                        const __m128i K9 = detail::aes_256_key_expansion(K7, K8);
-
-                        const __m128i K10 = detail::aes_128_key_expansion(K8, _mm_aeskeygenassist_si128(K9, 0x10));
-                        const __m128i K11 = detail::aes_256_key_expansion(K9, K10);
-
-                        const __m128i K12 = detail::aes_128_key_expansion(K10, _mm_aeskeygenassist_si128(K11, 0x20));
-                        const __m128i K13 = detail::aes_256_key_expansion(K11, K12);
-
-                        const __m128i K14 = detail::aes_128_key_expansion(K12, _mm_aeskeygenassist_si128(K13, 0x40));
-
-                        __m128i *EK_mm = reinterpret_cast<__m128i *>(encryption_key.data());
-                        _mm_storeu_si128(EK_mm, K0);
-                        _mm_storeu_si128(EK_mm + 1, K1);
-                        _mm_storeu_si128(EK_mm + 2, K2);
-                        _mm_storeu_si128(EK_mm + 3, K3);
-                        _mm_storeu_si128(EK_mm + 4, K4);
-                        _mm_storeu_si128(EK_mm + 5, K5);
-                        _mm_storeu_si128(EK_mm + 6, K6);
-                        _mm_storeu_si128(EK_mm + 7, K7);
-                        _mm_storeu_si128(EK_mm + 8, K8);
-                        _mm_storeu_si128(EK_mm + 9, K9);
-                        _mm_storeu_si128(EK_mm + 10, K10);
-                        _mm_storeu_si128(EK_mm + 11, K11);
-                        _mm_storeu_si128(EK_mm + 12, K12);
-                        _mm_storeu_si128(EK_mm + 13, K13);
-                        _mm_storeu_si128(EK_mm + 14, K14);
-
-                        // Now generate decryption keys
-                        __m128i *DK_mm = reinterpret_cast<__m128i *>(decryption_key.data());
-                        _mm_storeu_si128(DK_mm, K14);
-                        _mm_storeu_si128(DK_mm + 1, _mm_aesimc_si128(K13));
-                        _mm_storeu_si128(DK_mm + 2, _mm_aesimc_si128(K12));
-                        _mm_storeu_si128(DK_mm + 3, _mm_aesimc_si128(K11));
-                        _mm_storeu_si128(DK_mm + 4, _mm_aesimc_si128(K10));
-                        _mm_storeu_si128(DK_mm + 5, _mm_aesimc_si128(K9));
-                        _mm_storeu_si128(DK_mm + 6, _mm_aesimc_si128(K8));
-                        _mm_storeu_si128(DK_mm + 7, _mm_aesimc_si128(K7));
-                        _mm_storeu_si128(DK_mm + 8, _mm_aesimc_si128(K6));
-                        _mm_storeu_si128(DK_mm + 9, _mm_aesimc_si128(K5));
-                        _mm_storeu_si128(DK_mm + 10, _mm_aesimc_si128(K4));
-                        _mm_storeu_si128(DK_mm + 11, _mm_aesimc_si128(K3));
-                        _mm_storeu_si128(DK_mm + 12, _mm_aesimc_si128(K2));
-                        _mm_storeu_si128(DK_mm + 13, _mm_aesimc_si128(K1));
-                        _mm_storeu_si128(DK_mm + 14, K0);
+                        schedule_encryption_key(input_key, encryption_key);
+                        detail::aes_ni_inverse_schedule<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(encryption_key.data()),
+                            reinterpret_cast<__m128i *>(decryption_key.data()));
+                    }
+
+                protected:
+                    template<std::size_t Lanes>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void expand_encryption_keys(const key_type *input_keys, key_schedule_type *encryption_keys) {
+                        __m128i K0[Lanes], K1[Lanes];
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            __m128i *EK_mm = reinterpret_cast<__m128i *>(encryption_keys[l].data());
+                            K0[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data()));
+                            K1[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data() + 16));
+                            _mm_storeu_si128(EK_mm, K0[l]);
+                            _mm_storeu_si128(EK_mm + 1, K1[l]);
+                        }
+
+                        for (std::size_t r = 2; r <= policy_type::rounds; r += 2) {
+                            const __m128i rcon = _mm_set1_epi32(detail::aes_ni_rcon[r / 2 - 1]);
+                            for (std::size_t l = 0; l != Lanes; ++l) {
+                                __m128i *EK_mm = reinterpret_cast<__m128i *>(encryption_keys[l].data());
+                                K0[l] = detail::aes_128_key_expansion(K0[l],
+                                                                      detail::aes_ni_sub_word<3, true>(K1[l], rcon));
+                                _mm_storeu_si128(EK_mm + r, K0[l]);
+                                if (r != policy_type::rounds) {
+                                    K1[l] = detail::aes_128_key_expansion(
+                                        K1[l], detail::aes_ni_sub_word<3, false>(K0[l], _mm_setzero_si128()));
+                                    _mm_storeu_si128(EK_mm + r + 1, K1[l]);
+                                }
+                            }
+                        }
                     }
                 };
             }    // namespace detail
@@ -171,6 +171,13 @@ namespace nil {
                     typedef
                         typename ::nil::crypto3::detail::basic_functions<word_bits>::word_type key_schedule_word_type;
                     typedef std::array<key_schedule_word_type, key_schedule_words> key_schedule_type;
+
+                    // Schedules start on a cache line where heap allocations honour it too (aligned new)
+#if defined(__cpp_aligned_new)
+                    constexpr static const std::size_t key_schedule_alignment = 64;
+#else
+                    constexpr static const std::size_t key_schedule_alignment = alignof(key_schedule_type);
+#endif
                 };
 
                 template<std::size_t KeyBits>
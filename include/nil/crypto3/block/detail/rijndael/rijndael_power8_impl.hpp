@@ -73,8 +73,16 @@ namespace nil {
                     BOOST_STATIC_ASSERT(BlockBitsImpl == 128);
 
                 public:
+                    static inline void schedule_encryption_key(const key_type &key, key_schedule_type &encryption_key) {
+                        rijndael_impl<KeyBitsImpl, 128>::schedule_encryption_key(key, encryption_key);
+
+                        for (typename basic_type::key_schedule_type::value_type &c : encryption_key) {
+                            c = reverse_bytes(c);
+                        }
+                    }
+
                     static inline void schedule_key(const key_type &key,
-                                                    key_schedule_type encryption_key,
+                                                    key_schedule_type &encryption_key,
                                                     key_schedule_type &decryption_key) {
                         rijndael_impl<KeyBitsImpl, 128>::schedule_key(key, encryption_key, decryption_key);
 
@@ -85,6 +93,20 @@ namespace nil {
                             c = reverse_bytes(c);
                         }
                     }
+
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_encryption_key(input_keys[i], encryption_keys[i]);
+                        }
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_key(input_keys[i], encryption_keys[i], decryption_keys[i]);
+                        }
+                    }
                 };
 
                 template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl>
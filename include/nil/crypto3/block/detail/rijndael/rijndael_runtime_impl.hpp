@@ -0,0 +1,152 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_RIJNDAEL_RUNTIME_IMPL_HPP
+#define CRYPTO3_RIJNDAEL_RUNTIME_IMPL_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/block/detail/rijndael/rijndael_bitsliced_impl.hpp>
+#include <nil/crypto3/block/detail/rijndael/rijndael_ni_impl.hpp>
+#include <nil/crypto3/block/detail/rijndael/rijndael_ssse3_impl.hpp>
+#include <nil/crypto3/block/detail/rijndael/rijndael_vaes_impl.hpp>
+
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief Picks the fastest Rijndael implementation the running processor supports.
+                 * The choice is made once, on first use, from cpuid and stored as a table of
+                 * function pointers, so each call costs a single indirect branch. All
+                 * implementations share the policy key schedule type; a schedule is only ever
+                 * produced and consumed by the same selected implementation.
+                 */
+                template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl, typename PolicyType>
+                class rijndael_runtime_impl {
+                    typedef PolicyType policy_type;
+
+                    typedef typename policy_type::key_type key_type;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+                    typedef typename policy_type::block_type block_type;
+
+                    BOOST_STATIC_ASSERT(KeyBitsImpl == policy_type::key_bits);
+                    BOOST_STATIC_ASSERT(BlockBitsImpl == 128 && BlockBitsImpl == policy_type::block_bits);
+
+                    struct dispatch_table {
+                        void (*schedule_key)(const key_type &, key_schedule_type &, key_schedule_type &);
+                        void (*schedule_encryption_key)(const key_type &, key_schedule_type &);
+                        void (*schedule_keys)(const key_type *, std::size_t, key_schedule_type *,
+                                              key_schedule_type *);
+                        void (*schedule_encryption_keys)(const key_type *, std::size_t, key_schedule_type *);
+                        block_type (*encrypt_block)(const block_type &, const key_schedule_type &);
+                        block_type (*decrypt_block)(const block_type &, const key_schedule_type &);
+                        void (*encrypt_blocks)(const block_type *, block_type *, std::size_t,
+                                               const key_schedule_type &);
+                        void (*decrypt_blocks)(const block_type *, block_type *, std::size_t,
+                                               const key_schedule_type &);
+                    };
+
+                    template<typename Impl>
+                    static dispatch_table make_table() {
+                        return {&Impl::schedule_key,   &Impl::schedule_encryption_key, &Impl::schedule_keys,
+                                &Impl::schedule_encryption_keys, &Impl::encrypt_block,   &Impl::decrypt_block,
+                                &Impl::encrypt_blocks, &Impl::decrypt_blocks};
+                    }
+
+                    static dispatch_table select() {
+                        if (rijndael_vaes_impl<KeyBitsImpl, BlockBitsImpl, 512>::supported()) {
+                            return make_table<rijndael_vaes_impl<KeyBitsImpl, BlockBitsImpl, 512>>();
+                        }
+                        if (rijndael_vaes_impl<KeyBitsImpl, BlockBitsImpl, 256>::supported()) {
+                            return make_table<rijndael_vaes_impl<KeyBitsImpl, BlockBitsImpl, 256>>();
+                        }
+                        if (cpuid::has_aes_ni() && cpuid::has_ssse3()) {
+                            return make_table<rijndael_ni_impl<KeyBitsImpl, BlockBitsImpl>>();
+                        }
+                        if (cpuid::has_ssse3()) {
+                            return make_table<rijndael_ssse3_impl<KeyBitsImpl, BlockBitsImpl, policy_type>>();
+                        }
+                        return make_table<rijndael_bitsliced_impl<KeyBitsImpl, BlockBitsImpl>>();
+                    }
+
+                    static const dispatch_table &table() {
+                        static const dispatch_table t = select();
+                        return t;
+                    }
+
+                public:
+                    static block_type encrypt_block(const block_type &plaintext,
+                                                    const key_schedule_type &encryption_key) {
+                        return table().encrypt_block(plaintext, encryption_key);
+                    }
+
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        table().encrypt_blocks(in, out, n, encryption_key);
+                    }
+
+                    static block_type decrypt_block(const block_type &ciphertext,
+                                                    const key_schedule_type &decryption_key) {
+                        return table().decrypt_block(ciphertext, decryption_key);
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        table().decrypt_blocks(in, out, n, decryption_key);
+                    }
+
+                    static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
+                                             key_schedule_type &decryption_key) {
+                        table().schedule_key(input_key, encryption_key, decryption_key);
+                    }
+
+                    static void schedule_encryption_key(const key_type &input_key, key_schedule_type &encryption_key) {
+                        table().schedule_encryption_key(input_key, encryption_key);
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        table().schedule_keys(input_keys, n, encryption_keys, decryption_keys);
+                    }
+
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        table().schedule_encryption_keys(input_keys, n, encryption_keys);
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_RIJNDAEL_RUNTIME_IMPL_HPP
@@ -74,14 +74,14 @@ namespace nil {
 #define mm_xor3(x, y, z) _mm_xor_si128(x, _mm_xor_si128(y, z))
 
                 BOOST_ATTRIBUTE_TARGET("ssse3")
-                __m128i aes_schedule_transform(__m128i input, __m128i table_1, __m128i table_2) {
+                inline __m128i aes_schedule_transform(__m128i input, __m128i table_1, __m128i table_2) {
                     __m128i i_1 = _mm_and_si128(low_nibs, input);
                     __m128i i_2 = _mm_srli_epi32(_mm_andnot_si128(low_nibs, input), 4);
 
                     return _mm_xor_si128(_mm_shuffle_epi8(table_1, i_1), _mm_shuffle_epi8(table_2, i_2));
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_schedule_mangle(__m128i k, uint8_t round_no) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_schedule_mangle(__m128i k, uint8_t round_no) {
                     __m128i t = _mm_shuffle_epi8(_mm_xor_si128(k, _mm_set1_epi8(0x5B)), mc_forward[0]);
 
                     __m128i t2 = t;
@@ -93,11 +93,11 @@ namespace nil {
                     return _mm_shuffle_epi8(t2, sr[round_no % 4]);
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_schedule_192_smear(__m128i x, __m128i y) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_schedule_192_smear(__m128i x, __m128i y) {
                     return mm_xor3(y, _mm_shuffle_epi32(x, 0xFE), _mm_shuffle_epi32(y, 0x80));
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_schedule_mangle_dec(__m128i k, uint8_t round_no) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_schedule_mangle_dec(__m128i k, uint8_t round_no) {
                     const __m128i dsk[8] = {_mm_set_epi32(0x4AED9334, 0x82255BFC, 0xB6116FC8, 0x7ED9A700),
                                             _mm_set_epi32(0x8BB89FAC, 0xE9DAFDCE, 0x45765162, 0x27143300),
                                             _mm_set_epi32(0x4622EE8A, 0xADC90561, 0x27438FEB, 0xCCA86400),
@@ -122,7 +122,7 @@ namespace nil {
                     return _mm_shuffle_epi8(output, sr[round_no % 4]);
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_schedule_mangle_last(__m128i k, uint8_t round_no) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_schedule_mangle_last(__m128i k, uint8_t round_no) {
                     const __m128i out_tr1 = _mm_set_epi32(0xF7974121, 0xDEBE6808, 0xFF9F4929, 0xD6B66000);
                     const __m128i out_tr2 = _mm_set_epi32(0xE10D5DB1, 0xB05C0CE0, 0x01EDBD51, 0x50BCEC00);
 
@@ -131,7 +131,7 @@ namespace nil {
                     return aes_schedule_transform(k, out_tr1, out_tr2);
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_schedule_mangle_last_dec(__m128i k) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_schedule_mangle_last_dec(__m128i k) {
                     const __m128i deskew1 = _mm_set_epi32(0x1DFEB95A, 0x5DBEF91A, 0x07E4A340, 0x47A4E300);
                     const __m128i deskew2 = _mm_set_epi32(0x2841C2AB, 0xF49D1E77, 0x5F36B5DC, 0x83EA6900);
 
@@ -139,7 +139,7 @@ namespace nil {
                     return aes_schedule_transform(k, deskew1, deskew2);
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_schedule_round(__m128i *rcon, __m128i input1, __m128i input2) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_schedule_round(__m128i *rcon, __m128i input1, __m128i input2) {
                     if (rcon) {
                         input2 = _mm_xor_si128(_mm_alignr_epi8(_mm_setzero_si128(), *rcon, 15), input2);
 
@@ -169,7 +169,7 @@ namespace nil {
                     return mm_xor3(_mm_shuffle_epi8(sb1u, t5), _mm_shuffle_epi8(sb1t, t6), smeared);
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_ssse3_encrypt(__m128i B, const __m128i *keys, size_t rounds) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_ssse3_encrypt(__m128i B, const __m128i *keys, size_t rounds) {
                     const __m128i sb2u = _mm_set_epi32(0x5EB7E955, 0xBC982FCD, 0xE27A93C6, 0x0B712400);
                     const __m128i sb2t = _mm_set_epi32(0xC2A163C8, 0xAB82234A, 0x69EB8840, 0x0AE12900);
 
@@ -221,7 +221,7 @@ namespace nil {
                     }
                 }
 
-                BOOST_ATTRIBUTE_TARGET("ssse3") __m128i aes_ssse3_decrypt(__m128i B, const __m128i *keys, size_t rounds) {
+                BOOST_ATTRIBUTE_TARGET("ssse3") inline __m128i aes_ssse3_decrypt(__m128i B, const __m128i *keys, size_t rounds) {
                     const __m128i k_dipt1 = _mm_set_epi32(0x154A411E, 0x114E451A, 0x0F505B04, 0x0B545F00);
                     const __m128i k_dipt2 = _mm_set_epi32(0x12771772, 0xF491F194, 0x86E383E6, 0x60056500);
 
@@ -288,6 +288,149 @@ namespace nil {
                     }
                 }
 
+                /*
+                 * Four-way variants of the above. Each pshufb-based round is a long dependency chain, so
+                 * running four independent blocks side by side keeps the shuffle ports busy.
+                 */
+                BOOST_ATTRIBUTE_TARGET("ssse3")
+                inline void aes_ssse3_encrypt_x4(__m128i B[4], const __m128i *keys, size_t rounds) {
+                    const __m128i sb2u = _mm_set_epi32(0x5EB7E955, 0xBC982FCD, 0xE27A93C6, 0x0B712400);
+                    const __m128i sb2t = _mm_set_epi32(0xC2A163C8, 0xAB82234A, 0x69EB8840, 0x0AE12900);
+
+                    const __m128i sbou = _mm_set_epi32(0x15AABF7A, 0xC502A878, 0xD0D26D17, 0x6FBDC700);
+                    const __m128i sbot = _mm_set_epi32(0x8E1E90D1, 0x412B35FA, 0xCFE474A5, 0x5FBB6A00);
+
+                    const __m128i mc_backward[4] = {
+                        _mm_set_epi32(0x0E0D0C0F, 0x0A09080B, 0x06050407, 0x02010003),
+                        _mm_set_epi32(0x0A09080B, 0x06050407, 0x02010003, 0x0E0D0C0F),
+                        _mm_set_epi32(0x06050407, 0x02010003, 0x0E0D0C0F, 0x0A09080B),
+                        _mm_set_epi32(0x02010003, 0x0E0D0C0F, 0x0A09080B, 0x06050407),
+                    };
+
+                    const __m128i K0 = _mm_loadu_si128(keys);
+
+                    for (size_t i = 0; i != 4; ++i) {
+                        B[i] = mm_xor3(_mm_shuffle_epi8(k_ipt1, _mm_and_si128(low_nibs, B[i])),
+                                       _mm_shuffle_epi8(k_ipt2, _mm_srli_epi32(_mm_andnot_si128(low_nibs, B[i]), 4)),
+                                       K0);
+                    }
+
+                    for (size_t r = 1;; ++r) {
+                        const __m128i K = _mm_loadu_si128(keys + r);
+
+                        __m128i t5[4], t6[4];
+                        for (size_t i = 0; i != 4; ++i) {
+                            __m128i t = _mm_srli_epi32(_mm_andnot_si128(low_nibs, B[i]), 4);
+                            __m128i b = _mm_and_si128(low_nibs, B[i]);
+                            __m128i t2 = _mm_shuffle_epi8(k_inv2, b);
+
+                            b = _mm_xor_si128(b, t);
+
+                            __m128i t3 = _mm_xor_si128(t2, _mm_shuffle_epi8(k_inv1, t));
+                            __m128i t4 = _mm_xor_si128(t2, _mm_shuffle_epi8(k_inv1, b));
+
+                            t5[i] = _mm_xor_si128(b, _mm_shuffle_epi8(k_inv1, t3));
+                            t6[i] = _mm_xor_si128(t, _mm_shuffle_epi8(k_inv1, t4));
+                        }
+
+                        if (r == rounds) {
+                            for (size_t i = 0; i != 4; ++i) {
+                                B[i] = _mm_shuffle_epi8(
+                                    mm_xor3(_mm_shuffle_epi8(sbou, t5[i]), _mm_shuffle_epi8(sbot, t6[i]), K),
+                                    sr[r % 4]);
+                            }
+                            return;
+                        }
+
+                        for (size_t i = 0; i != 4; ++i) {
+                            __m128i t7 = mm_xor3(_mm_shuffle_epi8(sb1t, t6[i]), _mm_shuffle_epi8(sb1u, t5[i]), K);
+
+                            __m128i t8 = mm_xor3(_mm_shuffle_epi8(sb2t, t6[i]), _mm_shuffle_epi8(sb2u, t5[i]),
+                                                 _mm_shuffle_epi8(t7, mc_forward[r % 4]));
+
+                            B[i] = mm_xor3(_mm_shuffle_epi8(t8, mc_forward[r % 4]),
+                                           _mm_shuffle_epi8(t7, mc_backward[r % 4]), t8);
+                        }
+                    }
+                }
+
+                BOOST_ATTRIBUTE_TARGET("ssse3")
+                inline void aes_ssse3_decrypt_x4(__m128i B[4], const __m128i *keys, size_t rounds) {
+                    const __m128i k_dipt1 = _mm_set_epi32(0x154A411E, 0x114E451A, 0x0F505B04, 0x0B545F00);
+                    const __m128i k_dipt2 = _mm_set_epi32(0x12771772, 0xF491F194, 0x86E383E6, 0x60056500);
+
+                    const __m128i sb9u = _mm_set_epi32(0xCAD51F50, 0x4F994CC9, 0x851C0353, 0x9A86D600);
+                    const __m128i sb9t = _mm_set_epi32(0x725E2C9E, 0xB2FBA565, 0xC03B1789, 0xECD74900);
+
+                    const __m128i sbeu = _mm_set_epi32(0x22426004, 0x64B4F6B0, 0x46F29296, 0x26D4D000);
+                    const __m128i sbet = _mm_set_epi32(0x9467F36B, 0x98593E32, 0x0C55A6CD, 0xFFAAC100);
+
+                    const __m128i sbdu = _mm_set_epi32(0xF56E9B13, 0x882A4439, 0x7D57CCDF, 0xE6B1A200);
+                    const __m128i sbdt = _mm_set_epi32(0x2931180D, 0x15DEEFD3, 0x3CE2FAF7, 0x24C6CB00);
+
+                    const __m128i sbbu = _mm_set_epi32(0x602646F6, 0xB0F2D404, 0xD0226492, 0x96B44200);
+                    const __m128i sbbt = _mm_set_epi32(0xF3FF0C3E, 0x3255AA6B, 0xC19498A6, 0xCD596700);
+
+                    __m128i mc = mc_forward[3];
+
+                    const __m128i K0 = _mm_loadu_si128(keys);
+
+                    for (size_t i = 0; i != 4; ++i) {
+                        __m128i t = _mm_shuffle_epi8(k_dipt2, _mm_srli_epi32(_mm_andnot_si128(low_nibs, B[i]), 4));
+                        B[i] = mm_xor3(t, K0, _mm_shuffle_epi8(k_dipt1, _mm_and_si128(B[i], low_nibs)));
+                    }
+
+                    for (size_t r = 1;; ++r) {
+                        const __m128i K = _mm_loadu_si128(keys + r);
+
+                        __m128i t5[4], t6[4];
+                        for (size_t i = 0; i != 4; ++i) {
+                            __m128i t = _mm_srli_epi32(_mm_andnot_si128(low_nibs, B[i]), 4);
+                            __m128i b = _mm_and_si128(low_nibs, B[i]);
+                            __m128i t2 = _mm_shuffle_epi8(k_inv2, b);
+
+                            b = _mm_xor_si128(b, t);
+
+                            __m128i t3 = _mm_xor_si128(t2, _mm_shuffle_epi8(k_inv1, t));
+                            __m128i t4 = _mm_xor_si128(t2, _mm_shuffle_epi8(k_inv1, b));
+
+                            t5[i] = _mm_xor_si128(b, _mm_shuffle_epi8(k_inv1, t3));
+                            t6[i] = _mm_xor_si128(t, _mm_shuffle_epi8(k_inv1, t4));
+                        }
+
+                        if (r == rounds) {
+                            const __m128i sbou = _mm_set_epi32(0xC7AA6DB9, 0xD4943E2D, 0x1387EA53, 0x7EF94000);
+                            const __m128i sbot = _mm_set_epi32(0xCA4B8159, 0xD8C58E9C, 0x12D7560F, 0x93441D00);
+
+                            const uint32_t which_sr = ((((rounds - 1) << 4) ^ 48) & 48) / 16;
+
+                            for (size_t i = 0; i != 4; ++i) {
+                                __m128i x = mm_xor3(_mm_shuffle_epi8(sbou, t5[i]), K, _mm_shuffle_epi8(sbot, t6[i]));
+                                B[i] = _mm_shuffle_epi8(x, sr[which_sr]);
+                            }
+                            return;
+                        }
+
+                        for (size_t i = 0; i != 4; ++i) {
+                            __m128i t8 = _mm_xor_si128(_mm_shuffle_epi8(sb9t, t6[i]),
+                                                       _mm_xor_si128(_mm_shuffle_epi8(sb9u, t5[i]), K));
+
+                            __m128i t9 = mm_xor3(_mm_shuffle_epi8(t8, mc), _mm_shuffle_epi8(sbdu, t5[i]),
+                                                 _mm_shuffle_epi8(sbdt, t6[i]));
+
+                            __m128i t12 =
+                                _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(t9, mc), _mm_shuffle_epi8(sbbu, t5[i])),
+                                              _mm_shuffle_epi8(sbbt, t6[i]));
+
+                            B[i] = _mm_xor_si128(
+                                _mm_xor_si128(_mm_shuffle_epi8(t12, mc), _mm_shuffle_epi8(sbeu, t5[i])),
+                                _mm_shuffle_epi8(sbet, t6[i]));
+                        }
+
+                        mc = _mm_alignr_epi8(mc, mc, 12);
+                    }
+                }
+
                 template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl, typename PolicyType>
                 class basic_rijndael_ssse3_impl {
                     BOOST_STATIC_ASSERT(BlockBitsImpl == 128);
@@ -309,6 +452,7 @@ namespace nil {
                     BOOST_STATIC_ASSERT(PolicyType::block_bits == 128);
 
                 public:
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
                     static block_type encrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &encryption_key) {
                         block_type out = {0};
@@ -330,6 +474,32 @@ namespace nil {
                         return out;
                     }
 
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        const __m128i *in_mm = reinterpret_cast<const __m128i *>(in);
+                        __m128i *out_mm = reinterpret_cast<__m128i *>(out);
+
+                        const __m128i *keys = reinterpret_cast<const __m128i *>(encryption_key.data());
+
+                        for (; n >= 4; n -= 4, in_mm += 4, out_mm += 4) {
+                            __m128i B[4] = {_mm_loadu_si128(in_mm), _mm_loadu_si128(in_mm + 1),
+                                            _mm_loadu_si128(in_mm + 2), _mm_loadu_si128(in_mm + 3)};
+
+                            detail::aes_ssse3_encrypt_x4(B, keys, policy_type::rounds);
+
+                            for (std::size_t i = 0; i != 4; ++i) {
+                                _mm_storeu_si128(out_mm + i, B[i]);
+                            }
+                        }
+
+                        for (; n; --n) {
+                            __m128i B = _mm_loadu_si128(in_mm++);
+                            _mm_storeu_si128(out_mm++, detail::aes_ssse3_encrypt(B, keys, policy_type::rounds));
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
                         block_type out = {0};
@@ -350,6 +520,31 @@ namespace nil {
 
                         return out;
                     }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        const __m128i *in_mm = reinterpret_cast<const __m128i *>(in);
+                        __m128i *out_mm = reinterpret_cast<__m128i *>(out);
+
+                        const __m128i *keys = reinterpret_cast<const __m128i *>(decryption_key.data());
+
+                        for (; n >= 4; n -= 4, in_mm += 4, out_mm += 4) {
+                            __m128i B[4] = {_mm_loadu_si128(in_mm), _mm_loadu_si128(in_mm + 1),
+                                            _mm_loadu_si128(in_mm + 2), _mm_loadu_si128(in_mm + 3)};
+
+                            detail::aes_ssse3_decrypt_x4(B, keys, policy_type::rounds);
+
+                            for (std::size_t i = 0; i != 4; ++i) {
+                                _mm_storeu_si128(out_mm + i, B[i]);
+                            }
+                        }
+
+                        for (; n; --n) {
+                            __m128i B = _mm_loadu_si128(in_mm++);
+                            _mm_storeu_si128(out_mm++, detail::aes_ssse3_decrypt(B, keys, policy_type::rounds));
+                        }
+                    }
                 };
 
                 template<typename PolicyType>
@@ -363,35 +558,91 @@ namespace nil {
                     typedef typename policy_type::key_schedule_type key_schedule_type;
 
                 public:
+                    static void schedule_encryption_key(const key_type &input_key, key_schedule_type &encryption_key) {
+                        expand_keys<1>(&input_key, &encryption_key, nullptr);
+                    }
+
                     static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-                        __m128i rcon = _mm_set_epi32(0x702A9808, 0x4D7C7D81, 0x1F8391B9, 0xAF9DEEB6);
-
-                        __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data()));
+                        expand_keys<1>(&input_key, &encryption_key, &decryption_key);
+                    }
 
-                        __m128i *encryption_key_mm = reinterpret_cast<__m128i *>(encryption_key.data());
-                        __m128i *decryption_key_mm = reinterpret_cast<__m128i *>(decryption_key.data());
+                    /*!
+                     * @brief Expands n independent keys four at a time, so the shuffle chains of one key
+                     * overlap with the others.
+                     */
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (; n >= 4; n -= 4, input_keys += 4, encryption_keys += 4) {
+                            expand_keys<4>(input_keys, encryption_keys, nullptr);
+                        }
+                        for (; n; --n) {
+                            expand_keys<1>(input_keys++, encryption_keys++, nullptr);
+                        }
+                    }
 
-                        _mm_storeu_si128(decryption_key_mm + policy_type::rounds, _mm_shuffle_epi8(key, detail::sr[2]));
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (; n >= 4; n -= 4, input_keys += 4, encryption_keys += 4, decryption_keys += 4) {
+                            expand_keys<4>(input_keys, encryption_keys, decryption_keys);
+                        }
+                        for (; n; --n) {
+                            expand_keys<1>(input_keys++, encryption_keys++, decryption_keys++);
+                        }
+                    }
 
-                        key = detail::aes_schedule_transform(key, detail::k_ipt1, detail::k_ipt2);
+                protected:
+                    /*!
+                     * @brief Expands Lanes keys side by side, both schedules of each, or the encryption
+                     * ones only when decryption_keys is null.
+                     */
+                    template<std::size_t Lanes>
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static void expand_keys(const key_type *input_keys, key_schedule_type *encryption_keys,
+                                            key_schedule_type *decryption_keys) {
+                        __m128i rcon[Lanes], key[Lanes];
+                        __m128i *encryption_key_mm[Lanes], *decryption_key_mm[Lanes];
+
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            rcon[l] = _mm_set_epi32(0x702A9808, 0x4D7C7D81, 0x1F8391B9, 0xAF9DEEB6);
+                            key[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data()));
+
+                            encryption_key_mm[l] = reinterpret_cast<__m128i *>(encryption_keys[l].data());
+                            decryption_key_mm[l] =
+                                decryption_keys ? reinterpret_cast<__m128i *>(decryption_keys[l].data()) : nullptr;
+
+                            if (decryption_keys) {
+                                _mm_storeu_si128(decryption_key_mm[l] + policy_type::rounds,
+                                                 _mm_shuffle_epi8(key[l], detail::sr[2]));
+                            }
 
-                        _mm_storeu_si128(encryption_key_mm, key);
+                            key[l] = detail::aes_schedule_transform(key[l], detail::k_ipt1, detail::k_ipt2);
 
+                            _mm_storeu_si128(encryption_key_mm[l], key[l]);
+                        }
 
                         for (size_t i = 1; i != policy_type::rounds; ++i) {
-                            key = detail::aes_schedule_round(&rcon, key, key);
+                            for (std::size_t l = 0; l != Lanes; ++l) {
+                                key[l] = detail::aes_schedule_round(&rcon[l], key[l], key[l]);
 
-                            _mm_storeu_si128(encryption_key_mm + i, detail::aes_schedule_mangle(key, (12 - i) % 4));
+                                _mm_storeu_si128(encryption_key_mm[l] + i,
+                                                 detail::aes_schedule_mangle(key[l], (12 - i) % 4));
 
-                            _mm_storeu_si128(decryption_key_mm + (policy_type::rounds - i),
-                                             detail::aes_schedule_mangle_dec(key, (10 - i) % 4));
+                                if (decryption_keys) {
+                                    _mm_storeu_si128(decryption_key_mm[l] + (policy_type::rounds - i),
+                                                     detail::aes_schedule_mangle_dec(key[l], (10 - i) % 4));
+                                }
+                            }
                         }
 
-                        key = detail::aes_schedule_round(&rcon, key, key);
-                        _mm_storeu_si128(encryption_key_mm + policy_type::rounds,
-                                         detail::aes_schedule_mangle_last(key, 2));
-                        _mm_storeu_si128(decryption_key_mm, detail::aes_schedule_mangle_last_dec(key));
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            key[l] = detail::aes_schedule_round(&rcon[l], key[l], key[l]);
+                            _mm_storeu_si128(encryption_key_mm[l] + policy_type::rounds,
+                                             detail::aes_schedule_mangle_last(key[l], 2));
+                            if (decryption_keys) {
+                                _mm_storeu_si128(decryption_key_mm[l], detail::aes_schedule_mangle_last_dec(key[l]));
+                            }
+                        }
                     }
                 };
 
@@ -406,60 +657,119 @@ namespace nil {
                     typedef typename policy_type::key_schedule_type key_schedule_type;
 
                 public:
+                    static void schedule_encryption_key(const key_type &input_key, key_schedule_type &encryption_key) {
+                        expand_keys<1>(&input_key, &encryption_key, nullptr);
+                    }
+
                     static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-                        __m128i rcon = _mm_set_epi32(0x702A9808, 0x4D7C7D81, 0x1F8391B9, 0xAF9DEEB6);
-
-                        __m128i *encryption_key_mm = reinterpret_cast<__m128i *>(encryption_key.data());
-                        __m128i *decryption_key_mm = reinterpret_cast<__m128i *>(decryption_key.data());
+                        expand_keys<1>(&input_key, &encryption_key, &decryption_key);
+                    }
 
-                        __m128i key1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data()));
-                        __m128i key2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>((input_key.data() + 8)));
+                    /*!
+                     * @brief Expands n independent keys four at a time, so the shuffle chains of one key
+                     * overlap with the others.
+                     */
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (; n >= 4; n -= 4, input_keys += 4, encryption_keys += 4) {
+                            expand_keys<4>(input_keys, encryption_keys, nullptr);
+                        }
+                        for (; n; --n) {
+                            expand_keys<1>(input_keys++, encryption_keys++, nullptr);
+                        }
+                    }
 
-                        _mm_storeu_si128(decryption_key_mm + policy_type::rounds,
-                                         _mm_shuffle_epi8(key1, detail::sr[0]));
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (; n >= 4; n -= 4, input_keys += 4, encryption_keys += 4, decryption_keys += 4) {
+                            expand_keys<4>(input_keys, encryption_keys, decryption_keys);
+                        }
+                        for (; n; --n) {
+                            expand_keys<1>(input_keys++, encryption_keys++, decryption_keys++);
+                        }
+                    }
 
-                        key1 = detail::aes_schedule_transform(key1, detail::k_ipt1, detail::k_ipt2);
-                        key2 = detail::aes_schedule_transform(key2, detail::k_ipt1, detail::k_ipt2);
+                protected:
+                    /*!
+                     * @brief Expands Lanes keys side by side, both schedules of each, or the encryption
+                     * ones only when decryption_keys is null.
+                     */
+                    template<std::size_t Lanes>
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static void expand_keys(const key_type *input_keys, key_schedule_type *encryption_keys,
+                                            key_schedule_type *decryption_keys) {
+                        __m128i rcon[Lanes], key1[Lanes], key2[Lanes], t[Lanes];
+                        __m128i *encryption_key_mm[Lanes], *decryption_key_mm[Lanes];
+
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            rcon[l] = _mm_set_epi32(0x702A9808, 0x4D7C7D81, 0x1F8391B9, 0xAF9DEEB6);
+
+                            encryption_key_mm[l] = reinterpret_cast<__m128i *>(encryption_keys[l].data());
+                            decryption_key_mm[l] =
+                                decryption_keys ? reinterpret_cast<__m128i *>(decryption_keys[l].data()) : nullptr;
+
+                            key1[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data()));
+                            key2[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>((input_keys[l].data() + 8)));
+
+                            if (decryption_keys) {
+                                _mm_storeu_si128(decryption_key_mm[l] + policy_type::rounds,
+                                                 _mm_shuffle_epi8(key1[l], detail::sr[0]));
+                            }
 
-                        _mm_storeu_si128(encryption_key_mm + 0, key1);
+                            key1[l] = detail::aes_schedule_transform(key1[l], detail::k_ipt1, detail::k_ipt2);
+                            key2[l] = detail::aes_schedule_transform(key2[l], detail::k_ipt1, detail::k_ipt2);
 
-                        // key2 with 8 high bytes masked off
-                        __m128i t = _mm_slli_si128(_mm_srli_si128(key2, 8), 8);
+                            _mm_storeu_si128(encryption_key_mm[l] + 0, key1[l]);
 
+                            // key2 with 8 high bytes masked off
+                            t[l] = _mm_slli_si128(_mm_srli_si128(key2[l], 8), 8);
+                        }
 
                         for (size_t i = 0; i != 4; ++i) {
-                            key2 = detail::aes_schedule_round(&rcon, key2, key1);
-
-                            _mm_storeu_si128(encryption_key_mm + 3 * i + 1,
-                                             detail::aes_schedule_mangle(_mm_alignr_epi8(key2, t, 8), (i + 3) % 4));
-                            _mm_storeu_si128(decryption_key_mm + 11 - 3 * i,
-                                             detail::aes_schedule_mangle_dec(_mm_alignr_epi8(key2, t, 8), (i + 3) % 4));
-
-                            t = detail::aes_schedule_192_smear(key2, t);
-
-                            _mm_storeu_si128(encryption_key_mm + 3 * i + 2,
-                                             detail::aes_schedule_mangle(t, (i + 2) % 4));
-                            _mm_storeu_si128(decryption_key_mm + 10 - 3 * i,
-                                             detail::aes_schedule_mangle_dec(t, (i + 2) % 4));
-
-                            key2 = detail::aes_schedule_round(&rcon, t, key2);
-
-                            if (i == 3) {
-                                _mm_storeu_si128(encryption_key_mm + 3 * i + 3,
-                                                 detail::aes_schedule_mangle_last(key2, (i + 1) % 4));
-                                _mm_storeu_si128(decryption_key_mm + 9 - 3 * i,
-                                                 detail::aes_schedule_mangle_last_dec(key2));
-                            } else {
-                                _mm_storeu_si128(encryption_key_mm + 3 * i + 3,
-                                                 detail::aes_schedule_mangle(key2, (i + 1) % 4));
-                                _mm_storeu_si128(decryption_key_mm + 9 - 3 * i,
-                                                 detail::aes_schedule_mangle_dec(key2, (i + 1) % 4));
+                            for (std::size_t l = 0; l != Lanes; ++l) {
+                                key2[l] = detail::aes_schedule_round(&rcon[l], key2[l], key1[l]);
+
+                                const __m128i k = _mm_alignr_epi8(key2[l], t[l], 8);
+                                _mm_storeu_si128(encryption_key_mm[l] + 3 * i + 1,
+                                                 detail::aes_schedule_mangle(k, (i + 3) % 4));
+                                if (decryption_keys) {
+                                    _mm_storeu_si128(decryption_key_mm[l] + 11 - 3 * i,
+                                                     detail::aes_schedule_mangle_dec(k, (i + 3) % 4));
+                                }
+
+                                t[l] = detail::aes_schedule_192_smear(key2[l], t[l]);
+
+                                _mm_storeu_si128(encryption_key_mm[l] + 3 * i + 2,
+                                                 detail::aes_schedule_mangle(t[l], (i + 2) % 4));
+                                if (decryption_keys) {
+                                    _mm_storeu_si128(decryption_key_mm[l] + 10 - 3 * i,
+                                                     detail::aes_schedule_mangle_dec(t[l], (i + 2) % 4));
+                                }
+
+                                key2[l] = detail::aes_schedule_round(&rcon[l], t[l], key2[l]);
+
+                                if (i == 3) {
+                                    _mm_storeu_si128(encryption_key_mm[l] + 3 * i + 3,
+                                                     detail::aes_schedule_mangle_last(key2[l], (i + 1) % 4));
+                                    if (decryption_keys) {
+                                        _mm_storeu_si128(decryption_key_mm[l] + 9 - 3 * i,
+                                                         detail::aes_schedule_mangle_last_dec(key2[l]));
+                                    }
+                                } else {
+                                    _mm_storeu_si128(encryption_key_mm[l] + 3 * i + 3,
+                                                     detail::aes_schedule_mangle(key2[l], (i + 1) % 4));
+                                    if (decryption_keys) {
+                                        _mm_storeu_si128(decryption_key_mm[l] + 9 - 3 * i,
+                                                         detail::aes_schedule_mangle_dec(key2[l], (i + 1) % 4));
+                                    }
+                                }
+
+                                key1[l] = key2[l];
+                                key2[l] = detail::aes_schedule_192_smear(key2[l],
+                                                                         _mm_slli_si128(_mm_srli_si128(t[l], 8), 8));
+                                t[l] = _mm_slli_si128(_mm_srli_si128(key2[l], 8), 8);
                             }
-
-                            key1 = key2;
-                            key2 = detail::aes_schedule_192_smear(key2, _mm_slli_si128(_mm_srli_si128(t, 8), 8));
-                            t = _mm_slli_si128(_mm_srli_si128(key2, 8), 8);
                         }
                     }
                 };
@@ -475,46 +785,108 @@ namespace nil {
                     typedef typename policy_type::key_schedule_type key_schedule_type;
 
                 public:
+                    static void schedule_encryption_key(const key_type &input_key, key_schedule_type &encryption_key) {
+                        expand_keys<1>(&input_key, &encryption_key, nullptr);
+                    }
+
                     static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
                                              key_schedule_type &decryption_key) {
-                        __m128i rcon = _mm_set_epi32(0x702A9808, 0x4D7C7D81, 0x1F8391B9, 0xAF9DEEB6);
-
-                        __m128i *encryption_key_mm = reinterpret_cast<__m128i *>(encryption_key.data());
-                        __m128i *decryption_key_mm = reinterpret_cast<__m128i *>(decryption_key.data());
+                        expand_keys<1>(&input_key, &encryption_key, &decryption_key);
+                    }
 
-                        __m128i key1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_key.data()));
-                        __m128i key2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>((input_key.data() + 16)));
+                    /*!
+                     * @brief Expands n independent keys four at a time, so the shuffle chains of one key
+                     * overlap with the others.
+                     */
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (; n >= 4; n -= 4, input_keys += 4, encryption_keys += 4) {
+                            expand_keys<4>(input_keys, encryption_keys, nullptr);
+                        }
+                        for (; n; --n) {
+                            expand_keys<1>(input_keys++, encryption_keys++, nullptr);
+                        }
+                    }
 
-                        _mm_storeu_si128(decryption_key_mm + policy_type::rounds,
-                                         _mm_shuffle_epi8(key1, detail::sr[2]));
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (; n >= 4; n -= 4, input_keys += 4, encryption_keys += 4, decryption_keys += 4) {
+                            expand_keys<4>(input_keys, encryption_keys, decryption_keys);
+                        }
+                        for (; n; --n) {
+                            expand_keys<1>(input_keys++, encryption_keys++, decryption_keys++);
+                        }
+                    }
 
-                        key1 = detail::aes_schedule_transform(key1, detail::k_ipt1, detail::k_ipt2);
-                        key2 = detail::aes_schedule_transform(key2, detail::k_ipt1, detail::k_ipt2);
+                protected:
+                    /*!
+                     * @brief Expands Lanes keys side by side, both schedules of each, or the encryption
+                     * ones only when decryption_keys is null.
+                     */
+                    template<std::size_t Lanes>
+                    BOOST_ATTRIBUTE_TARGET("ssse3")
+                    static void expand_keys(const key_type *input_keys, key_schedule_type *encryption_keys,
+                                            key_schedule_type *decryption_keys) {
+                        __m128i rcon[Lanes], key1[Lanes], key2[Lanes];
+                        __m128i *encryption_key_mm[Lanes], *decryption_key_mm[Lanes];
+
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            rcon[l] = _mm_set_epi32(0x702A9808, 0x4D7C7D81, 0x1F8391B9, 0xAF9DEEB6);
+
+                            encryption_key_mm[l] = reinterpret_cast<__m128i *>(encryption_keys[l].data());
+                            decryption_key_mm[l] =
+                                decryption_keys ? reinterpret_cast<__m128i *>(decryption_keys[l].data()) : nullptr;
+
+                            key1[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_keys[l].data()));
+                            key2[l] = _mm_loadu_si128(reinterpret_cast<const __m128i *>((input_keys[l].data() + 16)));
+
+                            if (decryption_keys) {
+                                _mm_storeu_si128(decryption_key_mm[l] + policy_type::rounds,
+                                                 _mm_shuffle_epi8(key1[l], detail::sr[2]));
+                            }
 
-                        _mm_storeu_si128(encryption_key_mm + 0, key1);
-                        _mm_storeu_si128(encryption_key_mm + 1, detail::aes_schedule_mangle(key2, 3));
+                            key1[l] = detail::aes_schedule_transform(key1[l], detail::k_ipt1, detail::k_ipt2);
+                            key2[l] = detail::aes_schedule_transform(key2[l], detail::k_ipt1, detail::k_ipt2);
 
-                        _mm_storeu_si128(decryption_key_mm + 13, detail::aes_schedule_mangle_dec(key2, 1));
+                            _mm_storeu_si128(encryption_key_mm[l] + 0, key1[l]);
+                            _mm_storeu_si128(encryption_key_mm[l] + 1, detail::aes_schedule_mangle(key2[l], 3));
 
+                            if (decryption_keys) {
+                                _mm_storeu_si128(decryption_key_mm[l] + 13,
+                                                 detail::aes_schedule_mangle_dec(key2[l], 1));
+                            }
+                        }
 
                         for (size_t i = 2; i != 14; i += 2) {
-                            __m128i k_t = key2;
-                            key1 = key2 = detail::aes_schedule_round(&rcon, key2, key1);
-
-                            _mm_storeu_si128(encryption_key_mm + i, detail::aes_schedule_mangle(key2, i % 4));
-                            _mm_storeu_si128(decryption_key_mm + (14 - i),
-                                             detail::aes_schedule_mangle_dec(key2, (i + 2) % 4));
-
-                            key2 = detail::aes_schedule_round(nullptr, _mm_shuffle_epi32(key2, 0xFF), k_t);
-                            _mm_storeu_si128(encryption_key_mm + i + 1, detail::aes_schedule_mangle(key2, (i - 1) % 4));
-                            _mm_storeu_si128(decryption_key_mm + (13 - i),
-                                             detail::aes_schedule_mangle_dec(key2, (i + 1) % 4));
+                            for (std::size_t l = 0; l != Lanes; ++l) {
+                                __m128i k_t = key2[l];
+                                key1[l] = key2[l] = detail::aes_schedule_round(&rcon[l], key2[l], key1[l]);
+
+                                _mm_storeu_si128(encryption_key_mm[l] + i, detail::aes_schedule_mangle(key2[l], i % 4));
+                                if (decryption_keys) {
+                                    _mm_storeu_si128(decryption_key_mm[l] + (14 - i),
+                                                     detail::aes_schedule_mangle_dec(key2[l], (i + 2) % 4));
+                                }
+
+                                key2[l] = detail::aes_schedule_round(nullptr, _mm_shuffle_epi32(key2[l], 0xFF), k_t);
+                                _mm_storeu_si128(encryption_key_mm[l] + i + 1,
+                                                 detail::aes_schedule_mangle(key2[l], (i - 1) % 4));
+                                if (decryption_keys) {
+                                    _mm_storeu_si128(decryption_key_mm[l] + (13 - i),
+                                                     detail::aes_schedule_mangle_dec(key2[l], (i + 1) % 4));
+                                }
+                            }
                         }
 
-                        key2 = detail::aes_schedule_round(&rcon, key2, key1);
+                        for (std::size_t l = 0; l != Lanes; ++l) {
+                            key2[l] = detail::aes_schedule_round(&rcon[l], key2[l], key1[l]);
 
-                        _mm_storeu_si128(encryption_key_mm + 14, detail::aes_schedule_mangle_last(key2, 2));
-                        _mm_storeu_si128(decryption_key_mm + 0, detail::aes_schedule_mangle_last_dec(key2));
+                            _mm_storeu_si128(encryption_key_mm[l] + 14, detail::aes_schedule_mangle_last(key2[l], 2));
+                            if (decryption_keys) {
+                                _mm_storeu_si128(decryption_key_mm[l] + 0,
+                                                 detail::aes_schedule_mangle_last_dec(key2[l]));
+                            }
+                        }
                     }
                 };
 
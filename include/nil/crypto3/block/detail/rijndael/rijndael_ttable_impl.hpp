@@ -0,0 +1,289 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_RIJNDAEL_TTABLE_IMPL_HPP
+#define CRYPTO3_RIJNDAEL_TTABLE_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <boost/static_assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief Combined SubBytes/MixColumns lookup tables, one per state row and direction.
+                 * They are computed on first use rather than stored in the read-only segment, so
+                 * processes do not share the cache lines an attacker could flush and reload.
+                 */
+                template<typename PolicyType>
+                struct rijndael_ttables {
+                    typedef std::array<std::array<std::uint32_t, 256>, 4> table_type;
+
+                    table_type te, td;
+
+                    static std::uint8_t xtime(std::uint8_t x) {
+                        return static_cast<std::uint8_t>((x << 1) ^ ((x >> 7) * 0x1b));
+                    }
+
+                    static std::uint8_t gmul(std::uint8_t x, std::uint8_t y) {
+                        std::uint8_t r = 0;
+                        for (; y; y >>= 1, x = xtime(x)) {
+                            if (y & 1) {
+                                r ^= x;
+                            }
+                        }
+                        return r;
+                    }
+
+                    // Column bytes are stored little-endian: row 0 is the least significant byte
+                    static std::uint32_t column(std::uint8_t r0, std::uint8_t r1, std::uint8_t r2, std::uint8_t r3) {
+                        return static_cast<std::uint32_t>(r0) | static_cast<std::uint32_t>(r1) << 8 |
+                               static_cast<std::uint32_t>(r2) << 16 | static_cast<std::uint32_t>(r3) << 24;
+                    }
+
+                    rijndael_ttables() {
+                        for (std::size_t x = 0; x != 256; ++x) {
+                            const std::uint8_t s = PolicyType::constants[x];
+                            const std::uint8_t i = PolicyType::inverted_constants[x];
+
+                            te[0][x] = column(gmul(s, 2), s, s, gmul(s, 3));
+                            te[1][x] = column(gmul(s, 3), gmul(s, 2), s, s);
+                            te[2][x] = column(s, gmul(s, 3), gmul(s, 2), s);
+                            te[3][x] = column(s, s, gmul(s, 3), gmul(s, 2));
+
+                            td[0][x] = column(gmul(i, 14), gmul(i, 9), gmul(i, 13), gmul(i, 11));
+                            td[1][x] = column(gmul(i, 11), gmul(i, 14), gmul(i, 9), gmul(i, 13));
+                            td[2][x] = column(gmul(i, 13), gmul(i, 11), gmul(i, 14), gmul(i, 9));
+                            td[3][x] = column(gmul(i, 9), gmul(i, 13), gmul(i, 11), gmul(i, 14));
+                        }
+                    }
+
+                    static const rijndael_ttables &instance() {
+                        static const rijndael_ttables tables;
+                        return tables;
+                    }
+                };
+
+                /*!
+                 * @brief Word-oriented table implementation for any block size. Each round is
+                 * four lookups and xors per state column. Table lookups are indexed by secret
+                 * data, so unlike the SIMD and bitsliced implementations this one is not
+                 * constant-time; it serves the 160 to 256-bit block variants none of those cover.
+                 */
+                template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl>
+                class rijndael_ttable_impl {
+                    typedef rijndael_policy<KeyBitsImpl, BlockBitsImpl> policy_type;
+
+                    typedef typename policy_type::key_type key_type;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+                    typedef typename policy_type::block_type block_type;
+
+                    typedef rijndael_ttables<policy_type> tables_type;
+
+                    BOOST_STATIC_ASSERT(KeyBitsImpl == policy_type::key_bits);
+                    BOOST_STATIC_ASSERT(BlockBitsImpl == policy_type::block_bits);
+
+                    constexpr static const std::size_t nb = policy_type::block_words;
+                    constexpr static const std::size_t nk = policy_type::key_words;
+                    constexpr static const std::size_t rounds = policy_type::rounds;
+
+                    typedef std::array<std::uint32_t, nb> state_type;
+
+                    constexpr static const std::size_t e1 = policy_type::shift_offsets[0];
+                    constexpr static const std::size_t e2 = policy_type::shift_offsets[1];
+                    constexpr static const std::size_t e3 = policy_type::shift_offsets[2];
+                    constexpr static const std::size_t d1 = policy_type::inverted_shift_offsets[0];
+                    constexpr static const std::size_t d2 = policy_type::inverted_shift_offsets[1];
+                    constexpr static const std::size_t d3 = policy_type::inverted_shift_offsets[2];
+
+                    static std::uint32_t rotr8(std::uint32_t x) {
+                        return (x >> 8) | (x << 24);
+                    }
+
+                    static std::uint8_t byte(std::uint32_t x, std::size_t i) {
+                        return static_cast<std::uint8_t>(x >> (8 * i));
+                    }
+
+                    static std::uint32_t sub_word(std::uint32_t x, const typename policy_type::constants_type &sbox) {
+                        return tables_type::column(sbox[byte(x, 0)], sbox[byte(x, 1)], sbox[byte(x, 2)],
+                                                   sbox[byte(x, 3)]);
+                    }
+
+                    static state_type load(const block_type &in, const key_schedule_type &key) {
+                        state_type s;
+                        for (std::size_t c = 0; c != nb; ++c) {
+                            s[c] = tables_type::column(in[4 * c], in[4 * c + 1], in[4 * c + 2], in[4 * c + 3]) ^ key[c];
+                        }
+                        return s;
+                    }
+
+                    static block_type store(const state_type &s) {
+                        block_type out;
+                        for (std::size_t c = 0; c != nb; ++c) {
+                            for (std::size_t r = 0; r != 4; ++r) {
+                                out[4 * c + r] = byte(s[c], r);
+                            }
+                        }
+                        return out;
+                    }
+
+                    typedef std::make_index_sequence<nb> columns_type;
+
+                    /*
+                     * One round: row r of output column C comes from column C + Or (mod nb). Passing
+                     * the inverse offsets turns it into the inverse ShiftRows. Columns are expanded
+                     * at compile time so the state stays in registers.
+                     */
+                    template<std::size_t O1, std::size_t O2, std::size_t O3, std::size_t... C>
+                    static state_type round(const state_type &s, const typename tables_type::table_type &t,
+                                            const std::uint32_t *rk, std::index_sequence<C...>) {
+                        return {{(t[0][byte(s[C], 0)] ^ t[1][byte(s[(C + O1) % nb], 1)] ^
+                                  t[2][byte(s[(C + O2) % nb], 2)] ^ t[3][byte(s[(C + O3) % nb], 3)] ^ rk[C])...}};
+                    }
+
+                    template<std::size_t O1, std::size_t O2, std::size_t O3, std::size_t... C>
+                    static state_type last_round(const state_type &s, const typename policy_type::constants_type &sbox,
+                                                 const std::uint32_t *rk, std::index_sequence<C...>) {
+                        return {{(tables_type::column(sbox[byte(s[C], 0)], sbox[byte(s[(C + O1) % nb], 1)],
+                                                      sbox[byte(s[(C + O2) % nb], 2)],
+                                                      sbox[byte(s[(C + O3) % nb], 3)]) ^
+                                  rk[C])...}};
+                    }
+
+                    static std::uint32_t inv_mix_column(std::uint32_t x) {
+                        const typename tables_type::table_type &td = tables_type::instance().td;
+                        const typename policy_type::constants_type &sbox = policy_type::constants;
+
+                        // td applies InvSubBytes first, so feed it the forward S-box of each byte
+                        return td[0][sbox[byte(x, 0)]] ^ td[1][sbox[byte(x, 1)]] ^ td[2][sbox[byte(x, 2)]] ^
+                               td[3][sbox[byte(x, 3)]];
+                    }
+
+                public:
+                    static block_type encrypt_block(const block_type &plaintext,
+                                                    const key_schedule_type &encryption_key) {
+                        const typename tables_type::table_type &te = tables_type::instance().te;
+
+                        state_type s = load(plaintext, encryption_key);
+                        for (std::size_t r = 1; r != rounds; ++r) {
+                            s = round<e1, e2, e3>(s, te, encryption_key.data() + r * nb, columns_type());
+                        }
+                        return store(last_round<e1, e2, e3>(s, policy_type::constants,
+                                                            encryption_key.data() + rounds * nb, columns_type()));
+                    }
+
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = encrypt_block(in[i], encryption_key);
+                        }
+                    }
+
+                    static block_type decrypt_block(const block_type &ciphertext,
+                                                    const key_schedule_type &decryption_key) {
+                        const typename tables_type::table_type &td = tables_type::instance().td;
+
+                        state_type s = load(ciphertext, decryption_key);
+                        for (std::size_t r = 1; r != rounds; ++r) {
+                            s = round<d1, d2, d3>(s, td, decryption_key.data() + r * nb, columns_type());
+                        }
+                        return store(last_round<d1, d2, d3>(s, policy_type::inverted_constants,
+                                                            decryption_key.data() + rounds * nb, columns_type()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = decrypt_block(in[i], decryption_key);
+                        }
+                    }
+
+                    static void schedule_encryption_key(const key_type &input_key, key_schedule_type &encryption_key) {
+                        constexpr static const std::size_t total = nb * (rounds + 1);
+
+                        for (std::size_t i = 0; i != nk; ++i) {
+                            encryption_key[i] = tables_type::column(input_key[4 * i], input_key[4 * i + 1],
+                                                                    input_key[4 * i + 2], input_key[4 * i + 3]);
+                        }
+
+                        for (std::size_t i = nk; i != total; ++i) {
+                            std::uint32_t tmp = encryption_key[i - 1];
+                            if (i % nk == 0) {
+                                tmp = sub_word(rotr8(tmp), policy_type::constants) ^
+                                      policy_type::round_constants[i / nk - 1];
+                            } else if (nk > 6 && i % nk == 4) {
+                                tmp = sub_word(tmp, policy_type::constants);
+                            }
+                            encryption_key[i] = encryption_key[i - nk] ^ tmp;
+                        }
+                    }
+
+                    /*!
+                     * @brief The decryption schedule is laid out for the equivalent inverse cipher:
+                     * round keys in reverse order, with InvMixColumns applied to all but the outer two.
+                     */
+                    static void schedule_key(const key_type &input_key, key_schedule_type &encryption_key,
+                                             key_schedule_type &decryption_key) {
+                        schedule_encryption_key(input_key, encryption_key);
+
+                        for (std::size_t r = 0; r <= rounds; ++r) {
+                            for (std::size_t c = 0; c != nb; ++c) {
+                                const std::uint32_t k = encryption_key[(rounds - r) * nb + c];
+                                decryption_key[r * nb + c] = (r == 0 || r == rounds) ? k : inv_mix_column(k);
+                            }
+                        }
+                    }
+
+                    static void schedule_encryption_keys(const key_type *input_keys, std::size_t n,
+                                                         key_schedule_type *encryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_encryption_key(input_keys[i], encryption_keys[i]);
+                        }
+                    }
+
+                    static void schedule_keys(const key_type *input_keys, std::size_t n,
+                                              key_schedule_type *encryption_keys, key_schedule_type *decryption_keys) {
+                        for (std::size_t i = 0; i != n; ++i) {
+                            schedule_key(input_keys[i], encryption_keys[i], decryption_keys[i]);
+                        }
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_RIJNDAEL_TTABLE_IMPL_HPP
@@ -0,0 +1,216 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_RIJNDAEL_VAES_IMPL_HPP
+#define CRYPTO3_RIJNDAEL_VAES_IMPL_HPP
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include <nil/crypto3/block/detail/rijndael/rijndael_ni_impl.hpp>
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <nil/crypto3/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+
+#define AES_VAES_4_ROUNDS(OP, K) \
+    do {                         \
+        B0 = OP(B0, K);          \
+        B1 = OP(B1, K);          \
+        B2 = OP(B2, K);          \
+        B3 = OP(B3, K);          \
+    } while (0)
+
+/*
+ * Every round key is broadcast to all 128-bit lanes of a vector of LANES blocks. Four
+ * such vectors are kept in flight, then whole vectors, and the remaining blocks go
+ * through the AES-NI kernel.
+ */
+#define AES_VAES_BLOCKS(VEC, LANES, LOAD, STORE, XOR, BROADCAST, ROUND, LAST_ROUND, NI_BLOCKS)      \
+    do {                                                                                          \
+        VEC K[Rounds + 1];                                                                        \
+        for (std::size_t r = 0; r <= Rounds; ++r) {                                               \
+            K[r] = BROADCAST(_mm_loadu_si128(key_mm + r));                                        \
+        }                                                                                         \
+                                                                                                  \
+        while (blocks >= 4 * LANES) {                                                             \
+            VEC B0 = XOR(LOAD(reinterpret_cast<const VEC *>(in_mm + 0 * LANES)), K[0]);           \
+            VEC B1 = XOR(LOAD(reinterpret_cast<const VEC *>(in_mm + 1 * LANES)), K[0]);           \
+            VEC B2 = XOR(LOAD(reinterpret_cast<const VEC *>(in_mm + 2 * LANES)), K[0]);           \
+            VEC B3 = XOR(LOAD(reinterpret_cast<const VEC *>(in_mm + 3 * LANES)), K[0]);           \
+                                                                                                  \
+            for (std::size_t r = 1; r != Rounds; ++r) {                                           \
+                AES_VAES_4_ROUNDS(ROUND, K[r]);                                                   \
+            }                                                                                     \
+            AES_VAES_4_ROUNDS(LAST_ROUND, K[Rounds]);                                             \
+                                                                                                  \
+            STORE(reinterpret_cast<VEC *>(out_mm + 0 * LANES), B0);                               \
+            STORE(reinterpret_cast<VEC *>(out_mm + 1 * LANES), B1);                               \
+            STORE(reinterpret_cast<VEC *>(out_mm + 2 * LANES), B2);                               \
+            STORE(reinterpret_cast<VEC *>(out_mm + 3 * LANES), B3);                               \
+                                                                                                  \
+            in_mm += 4 * LANES;                                                                   \
+            out_mm += 4 * LANES;                                                                  \
+            blocks -= 4 * LANES;                                                                  \
+        }                                                                                         \
+                                                                                                  \
+        while (blocks >= LANES) {                                                                 \
+            VEC B = XOR(LOAD(reinterpret_cast<const VEC *>(in_mm)), K[0]);                        \
+            for (std::size_t r = 1; r != Rounds; ++r) {                                           \
+                B = ROUND(B, K[r]);                                                               \
+            }                                                                                     \
+            STORE(reinterpret_cast<VEC *>(out_mm), LAST_ROUND(B, K[Rounds]));                     \
+                                                                                                  \
+            in_mm += LANES;                                                                       \
+            out_mm += LANES;                                                                      \
+            blocks -= LANES;                                                                      \
+        }                                                                                         \
+                                                                                                  \
+        NI_BLOCKS<Rounds>(in_mm, out_mm, blocks, key_mm);                                         \
+    } while (0)
+
+                template<std::size_t VectorBits>
+                struct aes_vaes_kernel;
+
+                /*!
+                 * @brief AVX-512 flavour: sixteen blocks per iteration in four zmm registers.
+                 */
+                template<>
+                struct aes_vaes_kernel<512> {
+                    /*!
+                     * @brief Broadcasts a round key to the four lanes. The zero-masked form with a full
+                     * mask is the same instruction, but unlike _mm512_broadcast_i32x4 it doesn't pass an
+                     * undefined vector through, which g++ 12 reports as used uninitialized.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("avx512f")
+                    static inline __m512i broadcast_key(__m128i key) {
+                        return _mm512_maskz_broadcast_i32x4(0xFFFF, key);
+                    }
+
+                    template<std::size_t Rounds>
+                    BOOST_ATTRIBUTE_TARGET("avx512f,vaes,ssse3,aes")
+                    static void encrypt_blocks(const __m128i *in_mm, __m128i *out_mm, std::size_t blocks,
+                                               const __m128i *key_mm) {
+                        AES_VAES_BLOCKS(__m512i, 4, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_xor_si512,
+                                        broadcast_key, _mm512_aesenc_epi128, _mm512_aesenclast_epi128,
+                                        aes_ni_encrypt_blocks);
+                    }
+
+                    template<std::size_t Rounds>
+                    BOOST_ATTRIBUTE_TARGET("avx512f,vaes,ssse3,aes")
+                    static void decrypt_blocks(const __m128i *in_mm, __m128i *out_mm, std::size_t blocks,
+                                               const __m128i *key_mm) {
+                        AES_VAES_BLOCKS(__m512i, 4, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_xor_si512,
+                                        broadcast_key, _mm512_aesdec_epi128, _mm512_aesdeclast_epi128,
+                                        aes_ni_decrypt_blocks);
+                    }
+
+                    static bool supported() {
+                        return cpuid::has_vaes() && cpuid::has_avx512f() && cpuid::has_aes_ni();
+                    }
+                };
+
+                /*!
+                 * @brief AVX2 flavour for processors with VAES but without AVX-512: eight blocks per
+                 * iteration in four ymm registers.
+                 */
+                template<>
+                struct aes_vaes_kernel<256> {
+                    template<std::size_t Rounds>
+                    BOOST_ATTRIBUTE_TARGET("avx2,vaes,ssse3,aes")
+                    static void encrypt_blocks(const __m128i *in_mm, __m128i *out_mm, std::size_t blocks,
+                                               const __m128i *key_mm) {
+                        AES_VAES_BLOCKS(__m256i, 2, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_xor_si256,
+                                        _mm256_broadcastsi128_si256, _mm256_aesenc_epi128,
+                                        _mm256_aesenclast_epi128, aes_ni_encrypt_blocks);
+                    }
+
+                    template<std::size_t Rounds>
+                    BOOST_ATTRIBUTE_TARGET("avx2,vaes,ssse3,aes")
+                    static void decrypt_blocks(const __m128i *in_mm, __m128i *out_mm, std::size_t blocks,
+                                               const __m128i *key_mm) {
+                        AES_VAES_BLOCKS(__m256i, 2, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_xor_si256,
+                                        _mm256_broadcastsi128_si256, _mm256_aesdec_epi128,
+                                        _mm256_aesdeclast_epi128, aes_ni_decrypt_blocks);
+                    }
+
+                    static bool supported() {
+                        return cpuid::has_vaes() && cpuid::has_avx2() && cpuid::has_aes_ni();
+                    }
+                };
+
+#undef AES_VAES_BLOCKS
+#undef AES_VAES_4_ROUNDS
+
+                /*!
+                 * @brief Wide AES-NI implementation. Key schedule and single blocks are handled by
+                 * rijndael_ni_impl, batches go through the VAES kernel of the given vector width.
+                 */
+                template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl, std::size_t VectorBits = 512>
+                class rijndael_vaes_impl : public rijndael_ni_impl<KeyBitsImpl, BlockBitsImpl> {
+                    typedef rijndael_policy<KeyBitsImpl, BlockBitsImpl> policy_type;
+                    typedef typename policy_type::block_type block_type;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                    typedef aes_vaes_kernel<VectorBits> kernel_type;
+
+                    BOOST_STATIC_ASSERT(BlockBitsImpl == 128);
+
+                public:
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        kernel_type::template encrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        kernel_type::template decrypt_blocks<policy_type::rounds>(
+                            reinterpret_cast<const __m128i *>(in), reinterpret_cast<__m128i *>(out), n,
+                            reinterpret_cast<const __m128i *>(decryption_key.data()));
+                    }
+
+                    static bool supported() {
+                        return kernel_type::supported();
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_RIJNDAEL_VAES_IMPL_HPP
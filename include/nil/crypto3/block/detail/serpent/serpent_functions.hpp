@@ -0,0 +1,863 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_SERPENT_FUNCTIONS_HPP
+#define CRYPTO3_BLOCK_SERPENT_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/config.hpp>
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/block/detail/serpent/serpent_policy.hpp>
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#if (BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HAS_SERPENT_SIMD
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+#if defined(CRYPTO3_HAS_SERPENT_SIMD)
+                typedef std::uint32_t serpent_u32x4 __attribute__((vector_size(16)));
+                typedef std::uint32_t serpent_u32x8 __attribute__((vector_size(32)));
+#endif
+
+                /*!
+                 * @brief Serpent round functions, written once for any type with bitwise operators and
+                 * per-lane 32-bit shifts. With a plain word they run one block; with a GCC vector of
+                 * words, where lane i of word j holds word j of block i, the same code runs four
+                 * (SSE2) or eight (AVX2) blocks bitsliced.
+                 *
+                 * The S-boxes are Osvik's circuits ("Speeding up Serpent", 2000): 16 to 20 logical
+                 * operations each, with no table lookups.
+                 */
+                template<std::size_t KeyBits>
+                struct serpent_functions : public serpent_policy<KeyBits> {
+                    typedef serpent_policy<KeyBits> policy_type;
+
+                    constexpr static const std::size_t word_bits = policy_type::word_bits;
+                    typedef typename policy_type::word_type word_type;
+
+                    typedef typename policy_type::block_type block_type;
+                    typedef typename policy_type::key_type key_type;
+
+                    constexpr static const std::size_t rounds = policy_type::rounds;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                    template<std::size_t N, typename T>
+                    static BOOST_FORCEINLINE void rotate_left(T &x) {
+                        x = (x << N) | (x >> (word_bits - N));
+                    }
+
+                    template<std::size_t N, typename T>
+                    static BOOST_FORCEINLINE void rotate_right(T &x) {
+                        x = (x >> N) | (x << (word_bits - N));
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e1(T &B0, T &B1, T &B2, T &B3) {
+                        B3 ^= B0;
+                        T B4 = B1;
+                        B1 &= B3;
+                        B4 ^= B2;
+                        B1 ^= B0;
+                        B0 |= B3;
+                        B0 ^= B4;
+                        B4 ^= B3;
+                        B3 ^= B2;
+                        B2 |= B1;
+                        B2 ^= B4;
+                        B4 = ~B4;
+                        B4 |= B1;
+                        B1 ^= B3;
+                        B1 ^= B4;
+                        B3 |= B0;
+                        B1 ^= B3;
+                        B4 ^= B3;
+                        B3 = B0;
+                        B0 = B1;
+                        B1 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e2(T &B0, T &B1, T &B2, T &B3) {
+                        B0 = ~B0;
+                        B2 = ~B2;
+                        T B4 = B0;
+                        B0 &= B1;
+                        B2 ^= B0;
+                        B0 |= B3;
+                        B3 ^= B2;
+                        B1 ^= B0;
+                        B0 ^= B4;
+                        B4 |= B1;
+                        B1 ^= B3;
+                        B2 |= B0;
+                        B2 &= B4;
+                        B0 ^= B1;
+                        B1 &= B2;
+                        B1 ^= B0;
+                        B0 &= B2;
+                        B4 ^= B0;
+                        B0 = B2;
+                        B2 = B3;
+                        B3 = B1;
+                        B1 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e3(T &B0, T &B1, T &B2, T &B3) {
+                        T B4 = B0;
+                        B0 &= B2;
+                        B0 ^= B3;
+                        B2 ^= B1;
+                        B2 ^= B0;
+                        B3 |= B4;
+                        B3 ^= B1;
+                        B4 ^= B2;
+                        B1 = B3;
+                        B3 |= B4;
+                        B3 ^= B0;
+                        B0 &= B1;
+                        B4 ^= B0;
+                        B1 ^= B3;
+                        B1 ^= B4;
+                        B4 = ~B4;
+                        B0 = B2;
+                        B2 = B1;
+                        B1 = B3;
+                        B3 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e4(T &B0, T &B1, T &B2, T &B3) {
+                        T B4 = B0;
+                        B0 |= B3;
+                        B3 ^= B1;
+                        B1 &= B4;
+                        B4 ^= B2;
+                        B2 ^= B3;
+                        B3 &= B0;
+                        B4 |= B1;
+                        B3 ^= B4;
+                        B0 ^= B1;
+                        B4 &= B0;
+                        B1 ^= B3;
+                        B4 ^= B2;
+                        B1 |= B0;
+                        B1 ^= B2;
+                        B0 ^= B3;
+                        B2 = B1;
+                        B1 |= B3;
+                        B0 ^= B1;
+                        B1 = B2;
+                        B2 = B3;
+                        B3 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e5(T &B0, T &B1, T &B2, T &B3) {
+                        B1 ^= B3;
+                        B3 = ~B3;
+                        B2 ^= B3;
+                        B3 ^= B0;
+                        T B4 = B1;
+                        B1 &= B3;
+                        B1 ^= B2;
+                        B4 ^= B3;
+                        B0 ^= B4;
+                        B2 &= B4;
+                        B2 ^= B0;
+                        B0 &= B1;
+                        B3 ^= B0;
+                        B4 |= B1;
+                        B4 ^= B0;
+                        B0 |= B3;
+                        B0 ^= B2;
+                        B2 &= B3;
+                        B0 = ~B0;
+                        B4 ^= B2;
+                        B2 = B0;
+                        B0 = B1;
+                        B1 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e6(T &B0, T &B1, T &B2, T &B3) {
+                        B0 ^= B1;
+                        B1 ^= B3;
+                        B3 = ~B3;
+                        T B4 = B1;
+                        B1 &= B0;
+                        B2 ^= B3;
+                        B1 ^= B2;
+                        B2 |= B4;
+                        B4 ^= B3;
+                        B3 &= B1;
+                        B3 ^= B0;
+                        B4 ^= B1;
+                        B4 ^= B2;
+                        B2 ^= B0;
+                        B0 &= B3;
+                        B2 = ~B2;
+                        B0 ^= B4;
+                        B4 |= B3;
+                        B4 ^= B2;
+                        B2 = B0;
+                        B0 = B1;
+                        B1 = B3;
+                        B3 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e7(T &B0, T &B1, T &B2, T &B3) {
+                        B2 = ~B2;
+                        T B4 = B3;
+                        B3 &= B0;
+                        B0 ^= B4;
+                        B3 ^= B2;
+                        B2 |= B4;
+                        B1 ^= B3;
+                        B2 ^= B0;
+                        B0 |= B1;
+                        B2 ^= B1;
+                        B4 ^= B0;
+                        B0 |= B3;
+                        B0 ^= B2;
+                        B4 ^= B3;
+                        B4 ^= B0;
+                        B3 = ~B3;
+                        B2 &= B4;
+                        B2 ^= B3;
+                        B3 = B2;
+                        B2 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_e8(T &B0, T &B1, T &B2, T &B3) {
+                        T B4 = B1;
+                        B1 |= B2;
+                        B1 ^= B3;
+                        B4 ^= B2;
+                        B2 ^= B1;
+                        B3 |= B4;
+                        B3 &= B0;
+                        B4 ^= B2;
+                        B3 ^= B1;
+                        B1 |= B4;
+                        B1 ^= B0;
+                        B0 |= B4;
+                        B0 ^= B2;
+                        B1 ^= B4;
+                        B2 ^= B1;
+                        B1 &= B0;
+                        B1 ^= B4;
+                        B2 = ~B2;
+                        B2 |= B0;
+                        B4 ^= B2;
+                        B2 = B1;
+                        B1 = B3;
+                        B3 = B0;
+                        B0 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d1(T &B0, T &B1, T &B2, T &B3) {
+                        B2 = ~B2;
+                        T B4 = B1;
+                        B1 |= B0;
+                        B4 = ~B4;
+                        B1 ^= B2;
+                        B2 |= B4;
+                        B1 ^= B3;
+                        B0 ^= B4;
+                        B2 ^= B0;
+                        B0 &= B3;
+                        B4 ^= B0;
+                        B0 |= B1;
+                        B0 ^= B2;
+                        B3 ^= B4;
+                        B2 ^= B1;
+                        B3 ^= B0;
+                        B3 ^= B1;
+                        B2 &= B3;
+                        B4 ^= B2;
+                        B2 = B1;
+                        B1 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d2(T &B0, T &B1, T &B2, T &B3) {
+                        T B4 = B1;
+                        B1 ^= B3;
+                        B3 &= B1;
+                        B4 ^= B2;
+                        B3 ^= B0;
+                        B0 |= B1;
+                        B2 ^= B3;
+                        B0 ^= B4;
+                        B0 |= B2;
+                        B1 ^= B3;
+                        B0 ^= B1;
+                        B1 |= B3;
+                        B1 ^= B0;
+                        B4 = ~B4;
+                        B4 ^= B1;
+                        B1 |= B0;
+                        B1 ^= B0;
+                        B1 |= B4;
+                        B3 ^= B1;
+                        B1 = B0;
+                        B0 = B4;
+                        B4 = B2;
+                        B2 = B3;
+                        B3 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d3(T &B0, T &B1, T &B2, T &B3) {
+                        B2 ^= B3;
+                        B3 ^= B0;
+                        T B4 = B3;
+                        B3 &= B2;
+                        B3 ^= B1;
+                        B1 |= B2;
+                        B1 ^= B4;
+                        B4 &= B3;
+                        B2 ^= B3;
+                        B4 &= B0;
+                        B4 ^= B2;
+                        B2 &= B1;
+                        B2 |= B0;
+                        B3 = ~B3;
+                        B2 ^= B3;
+                        B0 ^= B3;
+                        B0 &= B1;
+                        B3 ^= B4;
+                        B3 ^= B0;
+                        B0 = B1;
+                        B1 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d4(T &B0, T &B1, T &B2, T &B3) {
+                        T B4 = B2;
+                        B2 ^= B1;
+                        B0 ^= B2;
+                        B4 &= B2;
+                        B4 ^= B0;
+                        B0 &= B1;
+                        B1 ^= B3;
+                        B3 |= B4;
+                        B2 ^= B3;
+                        B0 ^= B3;
+                        B1 ^= B4;
+                        B3 &= B2;
+                        B3 ^= B1;
+                        B1 ^= B0;
+                        B1 |= B2;
+                        B0 ^= B3;
+                        B1 ^= B4;
+                        B0 ^= B1;
+                        B4 = B0;
+                        B0 = B2;
+                        B2 = B3;
+                        B3 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d5(T &B0, T &B1, T &B2, T &B3) {
+                        T B4 = B2;
+                        B2 &= B3;
+                        B2 ^= B1;
+                        B1 |= B3;
+                        B1 &= B0;
+                        B4 ^= B2;
+                        B4 ^= B1;
+                        B1 &= B2;
+                        B0 = ~B0;
+                        B3 ^= B4;
+                        B1 ^= B3;
+                        B3 &= B0;
+                        B3 ^= B2;
+                        B0 ^= B1;
+                        B2 &= B0;
+                        B3 ^= B0;
+                        B2 ^= B4;
+                        B2 |= B3;
+                        B3 ^= B0;
+                        B2 ^= B1;
+                        B1 = B3;
+                        B3 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d6(T &B0, T &B1, T &B2, T &B3) {
+                        B1 = ~B1;
+                        T B4 = B3;
+                        B2 ^= B1;
+                        B3 |= B0;
+                        B3 ^= B2;
+                        B2 |= B1;
+                        B2 &= B0;
+                        B4 ^= B3;
+                        B2 ^= B4;
+                        B4 |= B0;
+                        B4 ^= B1;
+                        B1 &= B2;
+                        B1 ^= B3;
+                        B4 ^= B2;
+                        B3 &= B4;
+                        B4 ^= B1;
+                        B3 ^= B4;
+                        B4 = ~B4;
+                        B3 ^= B0;
+                        B0 = B1;
+                        B1 = B4;
+                        B4 = B2;
+                        B2 = B3;
+                        B3 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d7(T &B0, T &B1, T &B2, T &B3) {
+                        B0 ^= B2;
+                        T B4 = B2;
+                        B2 &= B0;
+                        B4 ^= B3;
+                        B2 = ~B2;
+                        B3 ^= B1;
+                        B2 ^= B3;
+                        B4 |= B0;
+                        B0 ^= B2;
+                        B3 ^= B4;
+                        B4 ^= B1;
+                        B1 &= B3;
+                        B1 ^= B0;
+                        B0 ^= B3;
+                        B0 |= B2;
+                        B3 ^= B1;
+                        B4 ^= B0;
+                        B0 = B1;
+                        B1 = B2;
+                        B2 = B4;
+                    }
+                    template<typename T>
+                    static BOOST_FORCEINLINE void sbox_d8(T &B0, T &B1, T &B2, T &B3) {
+                        T B4 = B2;
+                        B2 ^= B0;
+                        B0 &= B3;
+                        B4 |= B3;
+                        B2 = ~B2;
+                        B3 ^= B1;
+                        B1 |= B0;
+                        B0 ^= B2;
+                        B2 &= B4;
+                        B3 &= B4;
+                        B1 ^= B2;
+                        B2 ^= B0;
+                        B0 |= B2;
+                        B4 ^= B1;
+                        B0 ^= B3;
+                        B3 ^= B4;
+                        B4 |= B0;
+                        B3 ^= B2;
+                        B4 ^= B2;
+                        B2 = B1;
+                        B1 = B0;
+                        B0 = B3;
+                        B3 = B4;
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void transform(T &B0, T &B1, T &B2, T &B3) {
+                        rotate_left<13>(B0);
+                        rotate_left<3>(B2);
+                        B1 ^= B0 ^ B2;
+                        B3 ^= B2 ^ (B0 << 3);
+                        rotate_left<1>(B1);
+                        rotate_left<7>(B3);
+                        B0 ^= B1 ^ B3;
+                        B2 ^= B3 ^ (B1 << 7);
+                        rotate_left<5>(B0);
+                        rotate_left<22>(B2);
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void inverse_transform(T &B0, T &B1, T &B2, T &B3) {
+                        rotate_right<22>(B2);
+                        rotate_right<5>(B0);
+                        B2 ^= B3 ^ (B1 << 7);
+                        B0 ^= B1 ^ B3;
+                        rotate_right<7>(B3);
+                        rotate_right<1>(B1);
+                        B3 ^= B2 ^ (B0 << 3);
+                        B1 ^= B0 ^ B2;
+                        rotate_right<3>(B2);
+                        rotate_right<13>(B0);
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void key_xor(const key_schedule_type &schedule, std::size_t round, T &B0,
+                                                          T &B1, T &B2, T &B3) {
+                        B0 ^= schedule[4 * round];
+                        B1 ^= schedule[4 * round + 1];
+                        B2 ^= schedule[4 * round + 2];
+                        B3 ^= schedule[4 * round + 3];
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void encrypt_rounds(const key_schedule_type &schedule, T &B0, T &B1,
+                                                                 T &B2, T &B3) {
+                        for (std::size_t r = 0; r != rounds; r += 8) {
+                            key_xor(schedule, r, B0, B1, B2, B3);
+                            sbox_e1(B0, B1, B2, B3);
+                            transform(B0, B1, B2, B3);
+                            key_xor(schedule, r + 1, B0, B1, B2, B3);
+                            sbox_e2(B0, B1, B2, B3);
+                            transform(B0, B1, B2, B3);
+                            key_xor(schedule, r + 2, B0, B1, B2, B3);
+                            sbox_e3(B0, B1, B2, B3);
+                            transform(B0, B1, B2, B3);
+                            key_xor(schedule, r + 3, B0, B1, B2, B3);
+                            sbox_e4(B0, B1, B2, B3);
+                            transform(B0, B1, B2, B3);
+                            key_xor(schedule, r + 4, B0, B1, B2, B3);
+                            sbox_e5(B0, B1, B2, B3);
+                            transform(B0, B1, B2, B3);
+                            key_xor(schedule, r + 5, B0, B1, B2, B3);
+                            sbox_e6(B0, B1, B2, B3);
+                            transform(B0, B1, B2, B3);
+                            key_xor(schedule, r + 6, B0, B1, B2, B3);
+                            sbox_e7(B0, B1, B2, B3);
+                            transform(B0, B1, B2, B3);
+                            key_xor(schedule, r + 7, B0, B1, B2, B3);
+                            sbox_e8(B0, B1, B2, B3);
+                            // the last round replaces the linear transformation by a final key mixing
+                            if (r + 8 != rounds) {
+                                transform(B0, B1, B2, B3);
+                            }
+                        }
+                        key_xor(schedule, rounds, B0, B1, B2, B3);
+                    }
+
+                    template<typename T>
+                    static BOOST_FORCEINLINE void decrypt_rounds(const key_schedule_type &schedule, T &B0, T &B1,
+                                                                 T &B2, T &B3) {
+                        key_xor(schedule, rounds, B0, B1, B2, B3);
+                        for (std::size_t r = rounds; r != 0; r -= 8) {
+                            if (r != rounds) {
+                                inverse_transform(B0, B1, B2, B3);
+                            }
+                            sbox_d8(B0, B1, B2, B3);
+                            key_xor(schedule, r - 1, B0, B1, B2, B3);
+                            inverse_transform(B0, B1, B2, B3);
+                            sbox_d7(B0, B1, B2, B3);
+                            key_xor(schedule, r - 2, B0, B1, B2, B3);
+                            inverse_transform(B0, B1, B2, B3);
+                            sbox_d6(B0, B1, B2, B3);
+                            key_xor(schedule, r - 3, B0, B1, B2, B3);
+                            inverse_transform(B0, B1, B2, B3);
+                            sbox_d5(B0, B1, B2, B3);
+                            key_xor(schedule, r - 4, B0, B1, B2, B3);
+                            inverse_transform(B0, B1, B2, B3);
+                            sbox_d4(B0, B1, B2, B3);
+                            key_xor(schedule, r - 5, B0, B1, B2, B3);
+                            inverse_transform(B0, B1, B2, B3);
+                            sbox_d3(B0, B1, B2, B3);
+                            key_xor(schedule, r - 6, B0, B1, B2, B3);
+                            inverse_transform(B0, B1, B2, B3);
+                            sbox_d2(B0, B1, B2, B3);
+                            key_xor(schedule, r - 7, B0, B1, B2, B3);
+                            inverse_transform(B0, B1, B2, B3);
+                            sbox_d1(B0, B1, B2, B3);
+                            key_xor(schedule, r - 8, B0, B1, B2, B3);
+                        }
+                    }
+
+                    static void schedule_key(const key_type &key, key_schedule_type &schedule) {
+                        // 8 prekey words followed by the 132 words of the 33 round keys
+                        std::array<word_type, 8 + policy_type::key_schedule_size> W = {0};
+
+                        for (std::size_t i = 0; i != policy_type::key_words; ++i) {
+                            W[i] = key[i];
+                        }
+                        // Short keys are padded with a single one bit
+                        if (policy_type::key_words < 8) {
+                            W[policy_type::key_words] = 1;
+                        }
+
+                        for (std::size_t i = 8; i != W.size(); ++i) {
+                            W[i] = policy_type::template rotl<11>(W[i - 8] ^ W[i - 5] ^ W[i - 3] ^ W[i - 1] ^
+                                                                  policy_type::phi ^ static_cast<word_type>(i - 8));
+                        }
+
+                        // Round key r goes through S-box (3 - r) mod 8
+                        for (std::size_t r = 0; r <= rounds; ++r) {
+                            word_type *k = W.data() + 8 + 4 * r;
+                            switch ((35 - r) % 8) {
+                                case 0:
+                                    sbox_e1(k[0], k[1], k[2], k[3]);
+                                    break;
+                                case 1:
+                                    sbox_e2(k[0], k[1], k[2], k[3]);
+                                    break;
+                                case 2:
+                                    sbox_e3(k[0], k[1], k[2], k[3]);
+                                    break;
+                                case 3:
+                                    sbox_e4(k[0], k[1], k[2], k[3]);
+                                    break;
+                                case 4:
+                                    sbox_e5(k[0], k[1], k[2], k[3]);
+                                    break;
+                                case 5:
+                                    sbox_e6(k[0], k[1], k[2], k[3]);
+                                    break;
+                                case 6:
+                                    sbox_e7(k[0], k[1], k[2], k[3]);
+                                    break;
+                                default:
+                                    sbox_e8(k[0], k[1], k[2], k[3]);
+                                    break;
+                            }
+                        }
+
+                        std::copy(W.begin() + 8, W.end(), schedule.begin());
+                        W.fill(0);
+                    }
+
+                    static inline block_type encrypt_block(const block_type &plaintext,
+                                                           const key_schedule_type &schedule) {
+                        word_type B0 = plaintext[0], B1 = plaintext[1], B2 = plaintext[2], B3 = plaintext[3];
+                        encrypt_rounds(schedule, B0, B1, B2, B3);
+                        return {{B0, B1, B2, B3}};
+                    }
+
+                    static inline block_type decrypt_block(const block_type &ciphertext,
+                                                           const key_schedule_type &schedule) {
+                        word_type B0 = ciphertext[0], B1 = ciphertext[1], B2 = ciphertext[2], B3 = ciphertext[3];
+                        decrypt_rounds(schedule, B0, B1, B2, B3);
+                        return {{B0, B1, B2, B3}};
+                    }
+
+                    /*!
+                     * @brief Encrypts n blocks, eight at a time with AVX2 or four at a time with SSE2
+                     * where the processor has them, and the rest one by one.
+                     */
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &schedule) {
+#if defined(CRYPTO3_HAS_SERPENT_SIMD)
+                        if (n >= 8 && cpuid::has_avx2()) {
+                            const std::size_t done = encrypt_blocks_avx2(in, out, n, schedule);
+                            in += done;
+                            out += done;
+                            n -= done;
+                        }
+                        if (n >= 4 && cpuid::has_sse2()) {
+                            const std::size_t done = encrypt_blocks_sse2(in, out, n, schedule);
+                            in += done;
+                            out += done;
+                            n -= done;
+                        }
+#endif
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = encrypt_block(in[i], schedule);
+                        }
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                               const key_schedule_type &schedule) {
+#if defined(CRYPTO3_HAS_SERPENT_SIMD)
+                        if (n >= 8 && cpuid::has_avx2()) {
+                            const std::size_t done = decrypt_blocks_avx2(in, out, n, schedule);
+                            in += done;
+                            out += done;
+                            n -= done;
+                        }
+                        if (n >= 4 && cpuid::has_sse2()) {
+                            const std::size_t done = decrypt_blocks_sse2(in, out, n, schedule);
+                            in += done;
+                            out += done;
+                            n -= done;
+                        }
+#endif
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = decrypt_block(in[i], schedule);
+                        }
+                    }
+
+#if defined(CRYPTO3_HAS_SERPENT_SIMD)
+                    /*
+                     * The kernels below process whole groups of lanes and return how many blocks they
+                     * consumed. Blocks are loaded as rows and transposed, so that vector j holds word j
+                     * of every block; the transposition is its own inverse.
+                     */
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static BOOST_FORCEINLINE void transpose(__m128i &B0, __m128i &B1, __m128i &B2, __m128i &B3) {
+                        const __m128i T0 = _mm_unpacklo_epi32(B0, B1);
+                        const __m128i T1 = _mm_unpacklo_epi32(B2, B3);
+                        const __m128i T2 = _mm_unpackhi_epi32(B0, B1);
+                        const __m128i T3 = _mm_unpackhi_epi32(B2, B3);
+                        B0 = _mm_unpacklo_epi64(T0, T1);
+                        B1 = _mm_unpackhi_epi64(T0, T1);
+                        B2 = _mm_unpacklo_epi64(T2, T3);
+                        B3 = _mm_unpackhi_epi64(T2, T3);
+                    }
+
+                    // Transposes within each 128-bit lane: the low lanes carry blocks 0, 2, 4 and 6
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static BOOST_FORCEINLINE void transpose(__m256i &B0, __m256i &B1, __m256i &B2, __m256i &B3) {
+                        const __m256i T0 = _mm256_unpacklo_epi32(B0, B1);
+                        const __m256i T1 = _mm256_unpacklo_epi32(B2, B3);
+                        const __m256i T2 = _mm256_unpackhi_epi32(B0, B1);
+                        const __m256i T3 = _mm256_unpackhi_epi32(B2, B3);
+                        B0 = _mm256_unpacklo_epi64(T0, T1);
+                        B1 = _mm256_unpackhi_epi64(T0, T1);
+                        B2 = _mm256_unpacklo_epi64(T2, T3);
+                        B3 = _mm256_unpackhi_epi64(T2, T3);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static std::size_t encrypt_blocks_sse2(const block_type *in, block_type *out, std::size_t n,
+                                                           const key_schedule_type &schedule) {
+                        std::size_t i = 0;
+                        for (; i + 4 <= n; i += 4) {
+                            const __m128i *src = reinterpret_cast<const __m128i *>(in + i);
+                            __m128i B0 = _mm_loadu_si128(src), B1 = _mm_loadu_si128(src + 1),
+                                    B2 = _mm_loadu_si128(src + 2), B3 = _mm_loadu_si128(src + 3);
+                            transpose(B0, B1, B2, B3);
+
+                            serpent_u32x4 V0 = (serpent_u32x4)B0, V1 = (serpent_u32x4)B1, V2 = (serpent_u32x4)B2,
+                                          V3 = (serpent_u32x4)B3;
+                            encrypt_rounds(schedule, V0, V1, V2, V3);
+
+                            B0 = (__m128i)V0;
+                            B1 = (__m128i)V1;
+                            B2 = (__m128i)V2;
+                            B3 = (__m128i)V3;
+                            transpose(B0, B1, B2, B3);
+                            __m128i *dst = reinterpret_cast<__m128i *>(out + i);
+                            _mm_storeu_si128(dst, B0);
+                            _mm_storeu_si128(dst + 1, B1);
+                            _mm_storeu_si128(dst + 2, B2);
+                            _mm_storeu_si128(dst + 3, B3);
+                        }
+                        return i;
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("sse2")
+                    static std::size_t decrypt_blocks_sse2(const block_type *in, block_type *out, std::size_t n,
+                                                           const key_schedule_type &schedule) {
+                        std::size_t i = 0;
+                        for (; i + 4 <= n; i += 4) {
+                            const __m128i *src = reinterpret_cast<const __m128i *>(in + i);
+                            __m128i B0 = _mm_loadu_si128(src), B1 = _mm_loadu_si128(src + 1),
+                                    B2 = _mm_loadu_si128(src + 2), B3 = _mm_loadu_si128(src + 3);
+                            transpose(B0, B1, B2, B3);
+
+                            serpent_u32x4 V0 = (serpent_u32x4)B0, V1 = (serpent_u32x4)B1, V2 = (serpent_u32x4)B2,
+                                          V3 = (serpent_u32x4)B3;
+                            decrypt_rounds(schedule, V0, V1, V2, V3);
+
+                            B0 = (__m128i)V0;
+                            B1 = (__m128i)V1;
+                            B2 = (__m128i)V2;
+                            B3 = (__m128i)V3;
+                            transpose(B0, B1, B2, B3);
+                            __m128i *dst = reinterpret_cast<__m128i *>(out + i);
+                            _mm_storeu_si128(dst, B0);
+                            _mm_storeu_si128(dst + 1, B1);
+                            _mm_storeu_si128(dst + 2, B2);
+                            _mm_storeu_si128(dst + 3, B3);
+                        }
+                        return i;
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static std::size_t encrypt_blocks_avx2(const block_type *in, block_type *out, std::size_t n,
+                                                           const key_schedule_type &schedule) {
+                        std::size_t i = 0;
+                        for (; i + 8 <= n; i += 8) {
+                            const __m256i *src = reinterpret_cast<const __m256i *>(in + i);
+                            __m256i B0 = _mm256_loadu_si256(src), B1 = _mm256_loadu_si256(src + 1),
+                                    B2 = _mm256_loadu_si256(src + 2), B3 = _mm256_loadu_si256(src + 3);
+                            transpose(B0, B1, B2, B3);
+
+                            serpent_u32x8 V0 = (serpent_u32x8)B0, V1 = (serpent_u32x8)B1, V2 = (serpent_u32x8)B2,
+                                          V3 = (serpent_u32x8)B3;
+                            encrypt_rounds(schedule, V0, V1, V2, V3);
+
+                            B0 = (__m256i)V0;
+                            B1 = (__m256i)V1;
+                            B2 = (__m256i)V2;
+                            B3 = (__m256i)V3;
+                            transpose(B0, B1, B2, B3);
+                            __m256i *dst = reinterpret_cast<__m256i *>(out + i);
+                            _mm256_storeu_si256(dst, B0);
+                            _mm256_storeu_si256(dst + 1, B1);
+                            _mm256_storeu_si256(dst + 2, B2);
+                            _mm256_storeu_si256(dst + 3, B3);
+                        }
+                        return i;
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2")
+                    static std::size_t decrypt_blocks_avx2(const block_type *in, block_type *out, std::size_t n,
+                                                           const key_schedule_type &schedule) {
+                        std::size_t i = 0;
+                        for (; i + 8 <= n; i += 8) {
+                            const __m256i *src = reinterpret_cast<const __m256i *>(in + i);
+                            __m256i B0 = _mm256_loadu_si256(src), B1 = _mm256_loadu_si256(src + 1),
+                                    B2 = _mm256_loadu_si256(src + 2), B3 = _mm256_loadu_si256(src + 3);
+                            transpose(B0, B1, B2, B3);
+
+                            serpent_u32x8 V0 = (serpent_u32x8)B0, V1 = (serpent_u32x8)B1, V2 = (serpent_u32x8)B2,
+                                          V3 = (serpent_u32x8)B3;
+                            decrypt_rounds(schedule, V0, V1, V2, V3);
+
+                            B0 = (__m256i)V0;
+                            B1 = (__m256i)V1;
+                            B2 = (__m256i)V2;
+                            B3 = (__m256i)V3;
+                            transpose(B0, B1, B2, B3);
+                            __m256i *dst = reinterpret_cast<__m256i *>(out + i);
+                            _mm256_storeu_si256(dst, B0);
+                            _mm256_storeu_si256(dst + 1, B1);
+                            _mm256_storeu_si256(dst + 2, B2);
+                            _mm256_storeu_si256(dst + 3, B3);
+                        }
+                        return i;
+                    }
+#endif
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_SERPENT_FUNCTIONS_HPP
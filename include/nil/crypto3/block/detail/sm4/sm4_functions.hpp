@@ -0,0 +1,467 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_SM4_FUNCTIONS_HPP
+#define CRYPTO3_BLOCK_SM4_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/config.hpp>
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/block/detail/sm4/sm4_policy.hpp>
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#if (BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && defined(BOOST_ATTRIBUTE_TARGET)
+#define CRYPTO3_HAS_SM4_AES_NI
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief SM4 without lookup tables.
+                 *
+                 * The portable path computes the S-box algebraically on the four bytes of a word at
+                 * once, inverting by exponentiation with masked arithmetic, so that neither timing nor
+                 * memory access depends on secret data. It is slow and is only used where AES-NI is
+                 * missing.
+                 *
+                 * The AES-NI path relies on the SM4 and AES S-boxes both being affine maps around an
+                 * inversion in isomorphic fields: an affine map taking SM4 inputs into the AES field,
+                 * aesenclast with a zero round key, and an affine map back give the SM4 S-box for 16
+                 * bytes at a time. The affine maps are applied as two nibble pshufb lookups each.
+                 */
+                struct sm4_functions : public sm4_policy {
+                    typedef sm4_policy policy_type;
+
+                    /*!
+                     * @brief Rotates every byte of x left by N bits.
+                     */
+                    template<std::size_t N>
+                    static inline word_type rotate_bytes_left(word_type x) {
+                        constexpr const word_type high = 0x01010101u * ((0xFFu << N) & 0xFF);
+                        return ((x << N) & high) | ((x >> (8 - N)) & ~high);
+                    }
+
+                    static inline word_type affine(word_type x) {
+                        return x ^ rotate_bytes_left<1>(x) ^ rotate_bytes_left<3>(x) ^ rotate_bytes_left<6>(x) ^
+                               rotate_bytes_left<7>(x);
+                    }
+
+                    // Bytewise product in the SM4 field, branch-free in both operands
+                    static inline word_type multiply(word_type a, word_type b) {
+                        word_type r = 0;
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            r ^= a & (((b >> i) & 0x01010101) * 0xFF);
+                            a = ((a & 0x7F7F7F7F) << 1) ^ (((a >> 7) & 0x01010101) * field_reduction);
+                        }
+                        return r;
+                    }
+
+                    // x^254, which is the inverse of every nonzero byte and maps zero to zero
+                    static inline word_type inverse(word_type x) {
+                        const word_type x2 = multiply(x, x);
+                        const word_type x3 = multiply(x2, x);
+                        const word_type x6 = multiply(x3, x3);
+                        const word_type x12 = multiply(x6, x6);
+                        const word_type x15 = multiply(x12, x3);
+                        const word_type x30 = multiply(x15, x15);
+                        const word_type x60 = multiply(x30, x30);
+                        const word_type x120 = multiply(x60, x60);
+                        const word_type x240 = multiply(x120, x120);
+                        const word_type x252 = multiply(x240, x12);
+                        return multiply(x252, x2);
+                    }
+
+                    static inline word_type substitute(word_type x) {
+                        return affine(inverse(affine(x) ^ sbox_constant)) ^ sbox_constant;
+                    }
+
+                    static inline word_type linear(word_type b) {
+                        return b ^ policy_type::rotl<2>(b) ^ policy_type::rotl<10>(b) ^ policy_type::rotl<18>(b) ^
+                               policy_type::rotl<24>(b);
+                    }
+
+                    static inline word_type key_linear(word_type b) {
+                        return b ^ policy_type::rotl<13>(b) ^ policy_type::rotl<23>(b);
+                    }
+
+                    /*!
+                     * @brief Expands the key into the round keys, and the same in reverse order for
+                     * decryption. The S-box is the one from the fastest available path.
+                     */
+                    static void schedule_key(const key_type &key, key_schedule_type &encryption_key,
+                                             key_schedule_type &decryption_key) {
+#if defined(CRYPTO3_HAS_SM4_AES_NI)
+                        if (cpuid::has_aes_ni() && cpuid::has_ssse3()) {
+                            return expand_key(key, encryption_key, decryption_key, &substitute_aes_ni);
+                        }
+#endif
+                        expand_key(key, encryption_key, decryption_key, &substitute);
+                    }
+
+                    static inline block_type encrypt_block(const block_type &plaintext,
+                                                           const key_schedule_type &encryption_key) {
+                        block_type ciphertext;
+                        crypt_blocks(&plaintext, &ciphertext, 1, encryption_key);
+                        return ciphertext;
+                    }
+
+                    static inline block_type decrypt_block(const block_type &ciphertext,
+                                                           const key_schedule_type &decryption_key) {
+                        block_type plaintext;
+                        crypt_blocks(&ciphertext, &plaintext, 1, decryption_key);
+                        return plaintext;
+                    }
+
+                    /*!
+                     * @brief Runs n blocks through the rounds keyed by round_keys, which encrypts with
+                     * the encryption schedule and decrypts with the reversed one. Batches go up to 32
+                     * blocks at a time through VAES where the processor has it, then 16 or 4 at a time
+                     * through AES-NI.
+                     */
+                    static void crypt_blocks(const block_type *in, block_type *out, std::size_t n,
+                                             const key_schedule_type &round_keys) {
+#if defined(CRYPTO3_HAS_SM4_AES_NI)
+                        if (n >= 8 && cpuid::has_avx2() && cpuid::has_vaes()) {
+                            const std::size_t done = crypt_blocks_vaes(in, out, n, round_keys);
+                            in += done;
+                            out += done;
+                            n -= done;
+                        }
+                        if (n && cpuid::has_aes_ni() && cpuid::has_ssse3()) {
+                            return crypt_blocks_aes_ni(in, out, n, round_keys);
+                        }
+#endif
+                        for (std::size_t i = 0; i != n; ++i) {
+                            out[i] = crypt_block(in[i], round_keys);
+                        }
+                    }
+
+                    static inline block_type crypt_block(const block_type &in, const key_schedule_type &round_keys) {
+                        word_type X0 = in[0], X1 = in[1], X2 = in[2], X3 = in[3];
+
+                        for (std::size_t i = 0; i != rounds; i += 4) {
+                            X0 ^= linear(substitute(X1 ^ X2 ^ X3 ^ round_keys[i]));
+                            X1 ^= linear(substitute(X2 ^ X3 ^ X0 ^ round_keys[i + 1]));
+                            X2 ^= linear(substitute(X3 ^ X0 ^ X1 ^ round_keys[i + 2]));
+                            X3 ^= linear(substitute(X0 ^ X1 ^ X2 ^ round_keys[i + 3]));
+                        }
+
+                        return {{X3, X2, X1, X0}};
+                    }
+
+#if defined(CRYPTO3_HAS_SM4_AES_NI)
+                    /*!
+                     * @brief Nibble tables of the affine maps, the constants folded into the low nibble
+                     * ones: 0 and 1 take SM4 S-box inputs into the AES field, 2 and 3 take aesenclast
+                     * outputs back.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i affine_table(std::size_t i) {
+                        switch (i) {
+                            case 0:
+                                return _mm_set_epi64x(0x9814A8241D912DA1, 0x078B37BB820EB23E);
+                            case 1:
+                                return _mm_set_epi64x(0x3FE311CDFA26D408, 0x37EB19C5F22EDC00);
+                            case 2:
+                                return _mm_set_epi64x(0x47FF8D3579C1B30B, 0x2098EA521EA6D46C);
+                            default:
+                                return _mm_set_epi64x(0xED0DBD5D709020C0, 0x2DCD7D9DB050E000);
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i substitute(__m128i x) {
+                        const __m128i nibble = _mm_set1_epi8(0x0F);
+                        const __m128i inverse_shift_rows = byte_shuffle(0);
+
+                        const __m128i pre_lo = affine_table(0), pre_hi = affine_table(1);
+                        const __m128i post_lo = affine_table(2), post_hi = affine_table(3);
+
+                        x = _mm_shuffle_epi8(x, inverse_shift_rows);
+                        x = _mm_xor_si128(_mm_shuffle_epi8(pre_lo, _mm_and_si128(x, nibble)),
+                                          _mm_shuffle_epi8(pre_hi, _mm_and_si128(_mm_srli_epi32(x, 4), nibble)));
+                        x = _mm_aesenclast_si128(x, _mm_setzero_si128());
+                        return _mm_xor_si128(_mm_shuffle_epi8(post_lo, _mm_and_si128(x, nibble)),
+                                             _mm_shuffle_epi8(post_hi, _mm_and_si128(_mm_srli_epi32(x, 4), nibble)));
+                    }
+
+                    /*!
+                     * @brief pshufb masks: 0 cancels the ShiftRows done by aesenclast, 1 rotates every
+                     * word left by 8 bits.
+                     */
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i byte_shuffle(std::size_t i) {
+                        return i ? _mm_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3) :
+                                   _mm_set_epi8(3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0);
+                    }
+
+                    // L(B) = B ^ (B <<< 24) ^ ((B ^ (B <<< 8) ^ (B <<< 16)) <<< 2), byte rotations by pshufb
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE __m128i linear(__m128i b) {
+                        const __m128i rotate_8 = byte_shuffle(1);
+
+                        const __m128i b8 = _mm_shuffle_epi8(b, rotate_8);
+                        const __m128i b16 = _mm_shuffle_epi8(b8, rotate_8);
+                        const __m128i t = _mm_xor_si128(b, _mm_xor_si128(b8, b16));
+                        return _mm_xor_si128(_mm_xor_si128(b, _mm_shuffle_epi8(b16, rotate_8)),
+                                             _mm_or_si128(_mm_slli_epi32(t, 2), _mm_srli_epi32(t, 30)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static word_type substitute_aes_ni(word_type x) {
+                        return static_cast<word_type>(_mm_cvtsi128_si32(substitute(_mm_cvtsi32_si128(x))));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void transpose(__m128i &B0, __m128i &B1, __m128i &B2, __m128i &B3) {
+                        const __m128i T0 = _mm_unpacklo_epi32(B0, B1);
+                        const __m128i T1 = _mm_unpacklo_epi32(B2, B3);
+                        const __m128i T2 = _mm_unpackhi_epi32(B0, B1);
+                        const __m128i T3 = _mm_unpackhi_epi32(B2, B3);
+                        B0 = _mm_unpacklo_epi64(T0, T1);
+                        B1 = _mm_unpackhi_epi64(T0, T1);
+                        B2 = _mm_unpacklo_epi64(T2, T3);
+                        B3 = _mm_unpackhi_epi64(T2, T3);
+                    }
+
+                    // X[J] ^= T(X[J + 1] ^ X[J + 2] ^ X[J + 3] ^ k), indices modulo 4
+                    template<std::size_t Groups, std::size_t J>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void round(__m128i (&X)[Groups][4], word_type k) {
+                        const __m128i key = _mm_set1_epi32(static_cast<int>(k));
+                        for (std::size_t g = 0; g != Groups; ++g) {
+                            const __m128i t = _mm_xor_si128(_mm_xor_si128(X[g][(J + 1) % 4], X[g][(J + 2) % 4]),
+                                                            _mm_xor_si128(X[g][(J + 3) % 4], key));
+                            X[g][J] = _mm_xor_si128(X[g][J], linear(substitute(t)));
+                        }
+                    }
+
+                    /*!
+                     * @brief Runs 4 * Groups blocks. Each group is four blocks transposed so that X[j]
+                     * holds word j of all of them; the groups are interleaved to hide the latency of
+                     * aesenclast.
+                     */
+                    template<std::size_t Groups>
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static BOOST_FORCEINLINE void crypt_groups(const block_type *in, block_type *out,
+                                                               const key_schedule_type &round_keys) {
+                        __m128i X[Groups][4];
+
+                        for (std::size_t g = 0; g != Groups; ++g) {
+                            const __m128i *src = reinterpret_cast<const __m128i *>(in + 4 * g);
+                            for (std::size_t j = 0; j != 4; ++j) {
+                                X[g][j] = _mm_loadu_si128(src + j);
+                            }
+                            transpose(X[g][0], X[g][1], X[g][2], X[g][3]);
+                        }
+
+                        for (std::size_t i = 0; i != rounds; i += 4) {
+                            round<Groups, 0>(X, round_keys[i]);
+                            round<Groups, 1>(X, round_keys[i + 1]);
+                            round<Groups, 2>(X, round_keys[i + 2]);
+                            round<Groups, 3>(X, round_keys[i + 3]);
+                        }
+
+                        for (std::size_t g = 0; g != Groups; ++g) {
+                            transpose(X[g][3], X[g][2], X[g][1], X[g][0]);
+                            __m128i *dst = reinterpret_cast<__m128i *>(out + 4 * g);
+                            for (std::size_t j = 0; j != 4; ++j) {
+                                _mm_storeu_si128(dst + j, X[g][3 - j]);
+                            }
+                        }
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void crypt_blocks_aes_ni(const block_type *in, block_type *out, std::size_t n,
+                                                    const key_schedule_type &round_keys) {
+                        for (; n >= 16; n -= 16, in += 16, out += 16) {
+                            crypt_groups<4>(in, out, round_keys);
+                        }
+                        for (; n >= 4; n -= 4, in += 4, out += 4) {
+                            crypt_groups<1>(in, out, round_keys);
+                        }
+                        if (n) {
+                            // The last one to three blocks still take a full group
+                            block_type tail[4] = {};
+                            std::copy(in, in + n, tail);
+                            crypt_groups<1>(tail, tail, round_keys);
+                            std::copy(tail, tail + n, out);
+                            std::fill(tail, tail + 4, block_type());
+                        }
+                    }
+
+                    /*
+                     * The same kernel on 256-bit vectors with VAES. Every instruction involved works
+                     * within 128-bit lanes, so a vector simply carries two groups of four blocks: the
+                     * low lanes hold blocks 0, 2, 4 and 6 of the eight loaded, the high lanes the others.
+                     */
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i substitute(__m256i x) {
+                        const __m256i nibble = _mm256_set1_epi8(0x0F);
+                        const __m256i inverse_shift_rows = _mm256_broadcastsi128_si256(byte_shuffle(0));
+
+                        const __m256i pre_lo = _mm256_broadcastsi128_si256(affine_table(0)),
+                                      pre_hi = _mm256_broadcastsi128_si256(affine_table(1));
+                        const __m256i post_lo = _mm256_broadcastsi128_si256(affine_table(2)),
+                                      post_hi = _mm256_broadcastsi128_si256(affine_table(3));
+
+                        x = _mm256_shuffle_epi8(x, inverse_shift_rows);
+                        x = _mm256_xor_si256(
+                            _mm256_shuffle_epi8(pre_lo, _mm256_and_si256(x, nibble)),
+                            _mm256_shuffle_epi8(pre_hi, _mm256_and_si256(_mm256_srli_epi32(x, 4), nibble)));
+                        x = _mm256_aesenclast_epi128(x, _mm256_setzero_si256());
+                        return _mm256_xor_si256(
+                            _mm256_shuffle_epi8(post_lo, _mm256_and_si256(x, nibble)),
+                            _mm256_shuffle_epi8(post_hi, _mm256_and_si256(_mm256_srli_epi32(x, 4), nibble)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE __m256i linear(__m256i b) {
+                        const __m256i rotate_8 = _mm256_broadcastsi128_si256(byte_shuffle(1));
+
+                        const __m256i b8 = _mm256_shuffle_epi8(b, rotate_8);
+                        const __m256i b16 = _mm256_shuffle_epi8(b8, rotate_8);
+                        const __m256i t = _mm256_xor_si256(b, _mm256_xor_si256(b8, b16));
+                        return _mm256_xor_si256(_mm256_xor_si256(b, _mm256_shuffle_epi8(b16, rotate_8)),
+                                                _mm256_or_si256(_mm256_slli_epi32(t, 2), _mm256_srli_epi32(t, 30)));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void transpose(__m256i &B0, __m256i &B1, __m256i &B2, __m256i &B3) {
+                        const __m256i T0 = _mm256_unpacklo_epi32(B0, B1);
+                        const __m256i T1 = _mm256_unpacklo_epi32(B2, B3);
+                        const __m256i T2 = _mm256_unpackhi_epi32(B0, B1);
+                        const __m256i T3 = _mm256_unpackhi_epi32(B2, B3);
+                        B0 = _mm256_unpacklo_epi64(T0, T1);
+                        B1 = _mm256_unpackhi_epi64(T0, T1);
+                        B2 = _mm256_unpacklo_epi64(T2, T3);
+                        B3 = _mm256_unpackhi_epi64(T2, T3);
+                    }
+
+                    template<std::size_t Groups, std::size_t J>
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void round(__m256i (&X)[Groups][4], word_type k) {
+                        const __m256i key = _mm256_set1_epi32(static_cast<int>(k));
+                        for (std::size_t g = 0; g != Groups; ++g) {
+                            const __m256i t =
+                                _mm256_xor_si256(_mm256_xor_si256(X[g][(J + 1) % 4], X[g][(J + 2) % 4]),
+                                                 _mm256_xor_si256(X[g][(J + 3) % 4], key));
+                            X[g][J] = _mm256_xor_si256(X[g][J], linear(substitute(t)));
+                        }
+                    }
+
+                    template<std::size_t Groups>
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static BOOST_FORCEINLINE void crypt_wide_groups(const block_type *in, block_type *out,
+                                                                    const key_schedule_type &round_keys) {
+                        __m256i X[Groups][4];
+
+                        for (std::size_t g = 0; g != Groups; ++g) {
+                            const __m256i *src = reinterpret_cast<const __m256i *>(in + 8 * g);
+                            for (std::size_t j = 0; j != 4; ++j) {
+                                X[g][j] = _mm256_loadu_si256(src + j);
+                            }
+                            transpose(X[g][0], X[g][1], X[g][2], X[g][3]);
+                        }
+
+                        for (std::size_t i = 0; i != rounds; i += 4) {
+                            round<Groups, 0>(X, round_keys[i]);
+                            round<Groups, 1>(X, round_keys[i + 1]);
+                            round<Groups, 2>(X, round_keys[i + 2]);
+                            round<Groups, 3>(X, round_keys[i + 3]);
+                        }
+
+                        for (std::size_t g = 0; g != Groups; ++g) {
+                            transpose(X[g][3], X[g][2], X[g][1], X[g][0]);
+                            __m256i *dst = reinterpret_cast<__m256i *>(out + 8 * g);
+                            for (std::size_t j = 0; j != 4; ++j) {
+                                _mm256_storeu_si256(dst + j, X[g][3 - j]);
+                            }
+                        }
+                    }
+
+                    // Returns how many blocks it processed, a multiple of 8
+                    BOOST_ATTRIBUTE_TARGET("avx2,aes,vaes")
+                    static std::size_t crypt_blocks_vaes(const block_type *in, block_type *out, std::size_t n,
+                                                         const key_schedule_type &round_keys) {
+                        std::size_t i = 0;
+                        // The rounds are latency bound, so as many groups as possible are kept in flight
+                        for (; i + 32 <= n; i += 32) {
+                            crypt_wide_groups<4>(in + i, out + i, round_keys);
+                        }
+                        if (i + 16 <= n) {
+                            crypt_wide_groups<2>(in + i, out + i, round_keys);
+                            i += 16;
+                        }
+                        if (i + 8 <= n) {
+                            crypt_wide_groups<1>(in + i, out + i, round_keys);
+                            i += 8;
+                        }
+                        return i;
+                    }
+#endif
+
+                protected:
+                    static void expand_key(const key_type &key, key_schedule_type &encryption_key,
+                                           key_schedule_type &decryption_key, word_type (*sbox)(word_type)) {
+                        word_type K0 = key[0] ^ system_parameters[0], K1 = key[1] ^ system_parameters[1],
+                                  K2 = key[2] ^ system_parameters[2], K3 = key[3] ^ system_parameters[3];
+
+                        for (std::size_t i = 0; i != rounds; i += 4) {
+                            K0 ^= key_linear(sbox(K1 ^ K2 ^ K3 ^ fixed_parameters[i]));
+                            K1 ^= key_linear(sbox(K2 ^ K3 ^ K0 ^ fixed_parameters[i + 1]));
+                            K2 ^= key_linear(sbox(K3 ^ K0 ^ K1 ^ fixed_parameters[i + 2]));
+                            K3 ^= key_linear(sbox(K0 ^ K1 ^ K2 ^ fixed_parameters[i + 3]));
+
+                            encryption_key[i] = K0;
+                            encryption_key[i + 1] = K1;
+                            encryption_key[i + 2] = K2;
+                            encryption_key[i + 3] = K3;
+                        }
+
+                        std::reverse_copy(encryption_key.begin(), encryption_key.end(), decryption_key.begin());
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_SM4_FUNCTIONS_HPP
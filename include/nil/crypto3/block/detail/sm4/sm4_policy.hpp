@@ -0,0 +1,86 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_SM4_POLICY_HPP
+#define CRYPTO3_BLOCK_SM4_POLICY_HPP
+
+#include <array>
+
+#include <nil/crypto3/detail/basic_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                struct sm4_policy : ::nil::crypto3::detail::basic_functions<32> {
+                    constexpr static const std::size_t word_bits =
+                        ::nil::crypto3::detail::basic_functions<32>::word_bits;
+                    typedef typename ::nil::crypto3::detail::basic_functions<32>::word_type word_type;
+
+                    constexpr static const std::size_t block_bits = 128;
+                    constexpr static const std::size_t block_words = block_bits / word_bits;
+                    typedef std::array<word_type, block_words> block_type;
+
+                    constexpr static const std::size_t key_bits = 128;
+                    constexpr static const std::size_t key_words = key_bits / word_bits;
+                    typedef std::array<word_type, key_words> key_type;
+
+                    constexpr static const std::size_t rounds = 32;
+
+                    constexpr static const std::size_t key_schedule_size = rounds;
+                    typedef std::array<word_type, key_schedule_size> key_schedule_type;
+
+                    // FK, xored into the key before the expansion
+                    typedef std::array<word_type, key_words> system_parameters_type;
+                    constexpr static const system_parameters_type system_parameters = {0xA3B1BAC6, 0x56AA3350,
+                                                                                       0x677D9197, 0xB27022DC};
+
+                    // CK, one per round: byte j of word i is (4 * i + j) * 7 mod 256
+                    typedef std::array<word_type, rounds> fixed_parameters_type;
+                    constexpr static const fixed_parameters_type fixed_parameters = {
+                        0x00070E15, 0x1C232A31, 0x383F464D, 0x545B6269, 0x70777E85, 0x8C939AA1, 0xA8AFB6BD,
+                        0xC4CBD2D9, 0xE0E7EEF5, 0xFC030A11, 0x181F262D, 0x343B4249, 0x50575E65, 0x6C737A81,
+                        0x888F969D, 0xA4ABB2B9, 0xC0C7CED5, 0xDCE3EAF1, 0xF8FF060D, 0x141B2229, 0x30373E45,
+                        0x4C535A61, 0x686F767D, 0x848B9299, 0xA0A7AEB5, 0xBCC3CAD1, 0xD8DFE6ED, 0xF4FB0209,
+                        0x10171E25, 0x2C333A41, 0x484F565D, 0x646B7279};
+
+                    /*
+                     * The S-box is S(x) = A(I(A(x) + c)) + c, with I the inversion in GF(2^8) modulo
+                     * x^8 + x^7 + x^6 + x^5 + x^4 + x^2 + 1, A the circulant matrix applied by
+                     * sm4_functions::affine and c = 0xD3.
+                     */
+                    constexpr static const word_type sbox_constant = 0xD3D3D3D3;
+                    constexpr static const word_type field_reduction = 0xF5;
+                };
+
+                constexpr const typename sm4_policy::system_parameters_type sm4_policy::system_parameters;
+
+                constexpr const typename sm4_policy::fixed_parameters_type sm4_policy::fixed_parameters;
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_SM4_POLICY_HPP
@@ -1,14 +1,43 @@
-#include <nil/crypto3/utilities/cpuid/cpuid.hpp>
-#include <nil/crypto3/utilities/memory_operations.hpp>
-#include <nil/crypto3/utilities/loadstore.hpp>
-
-#if defined(BOOST_ARCH_X86)
-
-#if defined(CRYPTO3_BUILD_COMPILER_IS_MSVC)
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CPUID_X86_HPP
+#define CRYPTO3_CPUID_X86_HPP
+
+#include <cstring>
+
+#include <boost/predef/compiler.h>
+
+#include <nil/crypto3/block/detail/utilities/cpuid/cpuid.hpp>
+
+#if BOOST_ARCH_X86
+
+#if BOOST_COMP_MSVC
 #include <intrin.h>
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_INTEL)
+#elif BOOST_COMP_INTEL
 #include <ia32intrin.h>
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_GCC) || defined(CRYPTO3_BUILD_COMPILER_IS_CLANG)
+#elif BOOST_COMP_GNUC || BOOST_COMP_CLANG
 #include <cpuid.h>
 #endif
 
@@ -17,10 +46,22 @@
 namespace nil {
     namespace crypto3 {
 
-#if defined(BOOST_ARCH_X86)
+#if BOOST_ARCH_X86
+
+        inline uint64_t cpuid::os_saved_state() {
+#if BOOST_COMP_MSVC || BOOST_COMP_INTEL
+            return _xgetbv(0);
+#elif BOOST_COMP_GNUC || BOOST_COMP_CLANG
+            uint32_t lo = 0, hi = 0;
+            asm volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+            return 0;
+#endif
+        }
 
-        uint64_t cpuid::detect_cpu_features(size_t *cache_line_size) {
-#if defined(CRYPTO3_BUILD_COMPILER_IS_MSVC)
+        inline uint64_t cpuid::detect_cpu_features(size_t *cache_line_size) {
+#if BOOST_COMP_MSVC
 #define X86_CPUID(type, out)       \
     do {                           \
         __cpuid((int *)out, type); \
@@ -30,7 +71,7 @@ namespace nil {
         __cpuidex((int *)out, type, level);  \
     } while (0)
 
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_INTEL)
+#elif BOOST_COMP_INTEL
 #define X86_CPUID(type, out) \
     do {                     \
         __cpuid(out, type);  \
@@ -46,7 +87,7 @@ namespace nil {
 #define X86_CPUID_SUBLEVEL(type, level, out) \
     asm("cpuid\n\t" : "=a"(out[0]), "=b"(out[1]), "=c"(out[2]), "=d"(out[3]) : "0"(type), "2"(level))
 
-#elif defined(CRYPTO3_BUILD_COMPILER_IS_GCC) || defined(CRYPTO3_BUILD_COMPILER_IS_CLANG)
+#elif BOOST_COMP_GNUC || BOOST_COMP_CLANG
 #define X86_CPUID(type, out)                               \
     do {                                                   \
         __get_cpuid(type, out, out + 1, out + 2, out + 3); \
@@ -60,16 +101,17 @@ namespace nil {
 #warning "No way of calling x86 cpuid instruction for this compiler"
 #define X86_CPUID(type, out) \
     do {                     \
-        clear_mem(out, 4);   \
+        std::memset(out, 0, 4 * sizeof(uint32_t));   \
     } while (0)
 #define X86_CPUID_SUBLEVEL(type, level, out) \
     do {                                     \
-        clear_mem(out, 4);                   \
+        std::memset(out, 0, 4 * sizeof(uint32_t));                   \
     } while (0)
 #endif
 
             uint64_t features_detected = 0;
             uint32_t cpuid[4] = {0};
+            bool has_osxsave = false;
 
             // cpuid 0: vendor identification, max sublevel
             X86_CPUID(0, cpuid);
@@ -78,8 +120,8 @@ namespace nil {
 
             const uint32_t INTEL_CPUID[3] = {0x756E6547, 0x6C65746E, 0x49656E69};
             const uint32_t AMD_CPUID[3] = {0x68747541, 0x444D4163, 0x69746E65};
-            const bool is_intel = same_mem(cpuid + 1, INTEL_CPUID, 3);
-            const bool is_amd = same_mem(cpuid + 1, AMD_CPUID, 3);
+            const bool is_intel = std::memcmp(cpuid + 1, INTEL_CPUID, sizeof(INTEL_CPUID)) == 0;
+            const bool is_amd = std::memcmp(cpuid + 1, AMD_CPUID, sizeof(AMD_CPUID)) == 0;
 
             if (max_supported_sublevel >= 1) {
                 // cpuid 1: feature bits
@@ -94,9 +136,12 @@ namespace nil {
                     SSE41 = (1ULL << 51),
                     SSE42 = (1ULL << 52),
                     AESNI = (1ULL << 57),
+                    OSXSAVE = (1ULL << 59),
                     RDRAND = (1ULL << 62)
                 };
 
+                has_osxsave = (flags0 & x86_CPUID_1_bits::OSXSAVE) != 0;
+
                 if (flags0 & x86_CPUID_1_bits::RDTSC)
                     features_detected |= cpuid::CPUID_RDTSC_BIT;
                 if (flags0 & x86_CPUID_1_bits::SSE2)
@@ -117,15 +162,15 @@ namespace nil {
 
             if (is_intel) {
                 // Intel cache line size is in cpuid(1) output
-                *cache_line_size = 8 * extract_uint_t<CHAR_BIT>(cpuid[1], 2);
+                *cache_line_size = 8 * ((cpuid[1] >> 8) & 0xFF);
             } else if (is_amd) {
                 // AMD puts it in vendor zone
                 X86_CPUID(0x80000005, cpuid);
-                *cache_line_size = extract_uint_t<CHAR_BIT>(cpuid[2], 3);
+                *cache_line_size = cpuid[2] & 0xFF;
             }
 
             if (max_supported_sublevel >= 7) {
-                clear_mem(cpuid, 4);
+                std::memset(cpuid, 0, sizeof(cpuid));
                 X86_CPUID_SUBLEVEL(7, 0, cpuid);
 
                 enum x86_CPUID_7_bits : uint64_t {
@@ -135,6 +180,8 @@ namespace nil {
                     RDSEED = (1ULL << 18),
                     ADX = (1ULL << 19),
                     SHA = (1ULL << 29),
+                    VAES = (1ULL << 41),
+                    VPCLMULQDQ = (1ULL << 42),
                 };
                 uint64_t flags7 = (static_cast<uint64_t>(cpuid[2]) << 32) | cpuid[1];
 
@@ -150,16 +197,39 @@ namespace nil {
                     features_detected |= cpuid::CPUID_ADX_BIT;
                 if (flags7 & x86_CPUID_7_bits::SHA)
                     features_detected |= cpuid::CPUID_SHA_BIT;
+                if (flags7 & x86_CPUID_7_bits::VAES)
+                    features_detected |= cpuid::CPUID_VAES_BIT;
+                if (flags7 & x86_CPUID_7_bits::VPCLMULQDQ)
+                    features_detected |= cpuid::CPUID_VPCLMULQDQ_BIT;
             }
 
 #undef X86_CPUID
 #undef X86_CPUID_SUBLEVEL
 
+            /*
+             * The vector extensions are only usable if the operating system saves the wider
+             * register state on context switch, which XCR0 reports.
+             */
+            if (features_detected & (cpuid::CPUID_AVX2_BIT | cpuid::CPUID_AVX512F_BIT)) {
+                const uint64_t xcr0 = has_osxsave ? os_saved_state() : 0;
+
+                const uint64_t XSTATE_AVX = 0x06;
+                const uint64_t XSTATE_AVX512 = 0xE6;
+
+                if ((xcr0 & XSTATE_AVX) != XSTATE_AVX) {
+                    features_detected &= ~static_cast<uint64_t>(cpuid::CPUID_AVX2_BIT | cpuid::CPUID_VAES_BIT |
+                                                                cpuid::CPUID_VPCLMULQDQ_BIT);
+                }
+                if ((xcr0 & XSTATE_AVX512) != XSTATE_AVX512) {
+                    features_detected &= ~static_cast<uint64_t>(cpuid::CPUID_AVX512F_BIT);
+                }
+            }
+
             /*
              * If we don't have access to cpuid, we can still safely assume that
              * any x86-64 processor has SSE2 and RDTSC
              */
-#if defined(CRYPTO3_TARGET_ARCHITECTURE_IS_X86_64)
+#if BOOST_ARCH_X86_64
             if (features_detected == 0) {
                 features_detected |= cpuid::CPUID_SSE2_BIT;
                 features_detected |= cpuid::CPUID_RDTSC_BIT;
@@ -172,3 +242,5 @@ namespace nil {
 #endif
     }    // namespace crypto3
 }    // namespace nil
+
+#endif    // CRYPTO3_CPUID_X86_HPP
@@ -25,7 +25,10 @@
 #ifndef CRYPTO3_MEMORY_OPERATIONS_HPP
 #define CRYPTO3_MEMORY_OPERATIONS_HPP
 
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <new>
 #include <vector>
 
 #ifdef CRYPTO3_HAS_LOCKING_ALLOCATOR
@@ -45,7 +48,7 @@ namespace nil {
          * @param elem_size the size of each element
          * @return pointer to allocated and zeroed memory, or throw std::bad_alloc on failure
          */
-        __attribute__((malloc)) void *allocate_memory(size_t elems, size_t elem_size) {
+        __attribute__((malloc)) inline void *allocate_memory(size_t elems, size_t elem_size) {
 #if defined(CRYPTO3_HAS_LOCKING_ALLOCATOR)
             if (void *p = mlock_allocator::instance().allocate(elems, elem_size)) {
                 return p;
@@ -74,7 +77,7 @@ namespace nil {
          * @param ptr a pointer to memory to scrub
          * @param n the number of bytes pointed to by ptr
          */
-        void secure_scrub_memory(void *ptr, size_t n) {
+        inline void secure_scrub_memory(void *ptr, size_t n) {
 #if defined(CRYPTO3_TARGET_OS_HAS_RTLSECUREZEROMEMORY)
             ::RtlSecureZeroMemory(ptr, n);
 
@@ -107,7 +110,7 @@ namespace nil {
          * @param elems the number of elements, as passed to allocate_memory
          * @param elem_size the size of each element, as passed to allocate_memory
          */
-        void deallocate_memory(void *p, size_t elems, size_t elem_size) {
+        inline void deallocate_memory(void *p, size_t elems, size_t elem_size) {
             if (p == nullptr) {
                 return;
             }
@@ -126,7 +129,7 @@ namespace nil {
         /**
          * Ensure the allocator is initialized
          */
-        void initialize_allocator() {
+        inline void initialize_allocator() {
 #if defined(CRYPTO3_HAS_LOCKING_ALLOCATOR)
             mlock_allocator::instance();
 #endif
@@ -140,7 +143,7 @@ namespace nil {
          * @return true iff x[i] == y[i] forall i in [0...n)
          */
 
-        bool constant_time_compare(const uint8_t x[], const uint8_t y[], size_t len) {
+        inline bool constant_time_compare(const uint8_t x[], const uint8_t y[], size_t len) {
             volatile uint8_t difference = 0;
 
             for (size_t i = 0; i != len; ++i) {
@@ -25,6 +25,11 @@
 #ifndef CRYPTO3_SECURE_ALLOCATOR_HPP
 #define CRYPTO3_SECURE_ALLOCATOR_HPP
 
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/config.hpp>
+
 #include <nil/crypto3/block/detail/utilities/memory_operations.hpp>
 
 namespace nil {
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_XTS_TWEAK_HPP
+#define CRYPTO3_XTS_TWEAK_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/predef/hardware/simd.h>
+
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
+#include <emmintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief XTS tweak sequence. Tweaks are 128-bit little-endian elements of GF(2^128)
+                 * modulo x^128 + x^7 + x^2 + x + 1 and each block uses the previous tweak multiplied
+                 * by the primitive element.
+                 */
+                struct xts_tweak {
+                    typedef std::array<std::uint8_t, 16> block_type;
+
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
+                    /*
+                     * Shifts each 32-bit lane left by one and moves the lane carries one lane up,
+                     * the carry out of the top lane becomes the reduction constant in the bottom one.
+                     */
+                    inline static __m128i multiply_alpha(__m128i t) {
+                        __m128i carry = _mm_shuffle_epi32(_mm_srai_epi32(t, 31), 0x93);
+                        carry = _mm_and_si128(carry, _mm_set_epi32(1, 1, 1, 0x87));
+                        return _mm_xor_si128(_mm_slli_epi32(t, 1), carry);
+                    }
+
+                    /*!
+                     * @brief Writes t, t * a, ..., t * a^(n - 1) to out and leaves t * a^n in t.
+                     */
+                    inline static void sequence(block_type &t, block_type *out, std::size_t n) {
+                        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(t.data()));
+                        for (std::size_t i = 0; i != n; ++i) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(out[i].data()), x);
+                            x = multiply_alpha(x);
+                        }
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(t.data()), x);
+                    }
+#else
+                    inline static void sequence(block_type &t, block_type *out, std::size_t n) {
+                        std::uint64_t lo = 0, hi = 0;
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            lo |= static_cast<std::uint64_t>(t[i]) << (8 * i);
+                            hi |= static_cast<std::uint64_t>(t[8 + i]) << (8 * i);
+                        }
+
+                        for (std::size_t i = 0; i <= n; ++i) {
+                            block_type &x = i == n ? t : out[i];
+                            for (std::size_t j = 0; j != 8; ++j) {
+                                x[j] = static_cast<std::uint8_t>(lo >> (8 * j));
+                                x[8 + j] = static_cast<std::uint8_t>(hi >> (8 * j));
+                            }
+
+                            const std::uint64_t carry = 0 - (hi >> 63);
+                            hi = (hi << 1) | (lo >> 63);
+                            lo = (lo << 1) ^ (carry & 0x87);
+                        }
+                    }
+#endif
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_XTS_TWEAK_HPP
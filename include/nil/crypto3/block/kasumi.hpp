@@ -93,6 +93,18 @@ namespace nil {
                     return decrypt_block(ciphertext, key_schedule);
                 }
 
+                inline void encrypt_n(const block_type *plaintext, block_type *ciphertext, std::size_t n) const {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        ciphertext[i] = encrypt_block(plaintext[i], key_schedule);
+                    }
+                }
+
+                inline void decrypt_n(const block_type *ciphertext, block_type *plaintext, std::size_t n) const {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        plaintext[i] = decrypt_block(ciphertext[i], key_schedule);
+                    }
+                }
+
             protected:
                 inline block_type encrypt_block(const block_type &plaintext,
                                                 const key_schedule_type &key_schedule) const {
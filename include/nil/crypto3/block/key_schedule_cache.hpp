@@ -0,0 +1,255 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_KEY_SCHEDULE_CACHE_HPP
+#define CRYPTO3_BLOCK_KEY_SCHEDULE_CACHE_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+#include <nil/crypto3/block/detail/utilities/secure_allocator.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @brief Thread-safe LRU cache of keyed cipher objects.
+             *
+             * @ingroup block
+             *
+             * Servers holding many long-lived keys can look a cipher up by its key instead of
+             * expanding the key schedule on every request. Each entry holds the key and the keyed
+             * cipher in memory obtained through secure_allocator. Entries are handed out as
+             * shared pointers, so an entry evicted while still in use stays valid for its
+             * holders; the memory is scrubbed through secure_scrub_memory once the last holder
+             * lets go.
+             *
+             * Lookups are indexed by a salted 64-bit digest of the key, and a candidate entry
+             * only matches after a constant-time comparison of the full key. Keys are expanded
+             * outside the lock, so a miss does not stall lookups from other threads.
+             *
+             * @tparam Cipher Block cipher constructible from its key_type, whose key_type is an
+             * array of unsigned integers
+             */
+            template<typename Cipher>
+            class key_schedule_cache {
+            public:
+                typedef Cipher cipher_type;
+                typedef typename cipher_type::key_type key_type;
+                typedef std::shared_ptr<const cipher_type> pointer;
+
+                /*!
+                 * @param capacity Maximum number of keys kept, at least one
+                 */
+                explicit key_schedule_cache(std::size_t capacity) :
+                    max_entries(capacity), hit_count(0), miss_count(0), salt(random_salt()) {
+                    if (!capacity) {
+                        throw std::invalid_argument("key schedule cache capacity must be positive");
+                    }
+                }
+
+                key_schedule_cache(const key_schedule_cache &) = delete;
+                key_schedule_cache &operator=(const key_schedule_cache &) = delete;
+
+                /*!
+                 * @brief Returns the cipher keyed with key, expanding and caching the key schedule
+                 * on a miss and evicting the least recently used entry when the cache is full.
+                 */
+                pointer get(const key_type &key) {
+                    const std::uint64_t digest = key_digest(key);
+
+                    {
+                        std::lock_guard<std::mutex> lock(guard);
+                        typename lru_list::iterator it = find(digest, key);
+                        if (it != entries.end()) {
+                            ++hit_count;
+                            entries.splice(entries.begin(), entries, it);
+                            return pointer(*it, &(*it)->cipher);
+                        }
+                        ++miss_count;
+                    }
+
+                    std::shared_ptr<slot> fresh = make_slot(key);
+
+                    std::lock_guard<std::mutex> lock(guard);
+                    typename lru_list::iterator it = find(digest, key);
+                    if (it != entries.end()) {
+                        // Another thread cached the same key meanwhile
+                        entries.splice(entries.begin(), entries, it);
+                        return pointer(*it, &(*it)->cipher);
+                    }
+
+                    entries.push_front(fresh);
+                    index.emplace(digest, entries.begin());
+
+                    while (entries.size() > max_entries) {
+                        evict(std::prev(entries.end()));
+                    }
+
+                    return pointer(fresh, &fresh->cipher);
+                }
+
+                /*!
+                 * @brief Drops the entry for key, if any.
+                 */
+                void erase(const key_type &key) {
+                    const std::uint64_t digest = key_digest(key);
+
+                    std::lock_guard<std::mutex> lock(guard);
+                    typename lru_list::iterator it = find(digest, key);
+                    if (it != entries.end()) {
+                        evict(it);
+                    }
+                }
+
+                void clear() {
+                    std::lock_guard<std::mutex> lock(guard);
+                    index.clear();
+                    entries.clear();
+                }
+
+                std::size_t size() const {
+                    std::lock_guard<std::mutex> lock(guard);
+                    return entries.size();
+                }
+
+                std::size_t capacity() const {
+                    return max_entries;
+                }
+
+                std::uint64_t hits() const {
+                    std::lock_guard<std::mutex> lock(guard);
+                    return hit_count;
+                }
+
+                std::uint64_t misses() const {
+                    std::lock_guard<std::mutex> lock(guard);
+                    return miss_count;
+                }
+
+            protected:
+                typedef typename key_type::value_type key_value_type;
+                constexpr static const std::size_t key_bytes = sizeof(key_type);
+
+                static_assert(std::is_unsigned<key_value_type>::value, "cipher keys must be arrays of unsigned integers");
+
+                struct slot {
+                    explicit slot(const key_type &k) : key(k), cipher(k) {
+                    }
+
+                    key_type key;
+                    cipher_type cipher;
+                };
+
+                typedef std::list<std::shared_ptr<slot>> lru_list;
+                typedef std::unordered_multimap<std::uint64_t, typename lru_list::iterator> index_type;
+
+                /*!
+                 * @brief Places the slot in secure_allocator memory, over-allocated so that
+                 * over-aligned ciphers can be placed too. The deleter runs the cipher destructor and
+                 * hands the memory back to deallocate_memory, which scrubs it before freeing.
+                 */
+                static std::shared_ptr<slot> make_slot(const key_type &key) {
+                    const std::size_t bytes = sizeof(slot) + alignof(slot) - 1;
+
+                    secure_allocator<std::uint8_t> allocator;
+                    std::uint8_t *raw = allocator.allocate(bytes);
+
+                    void *aligned = raw;
+                    std::size_t space = bytes;
+                    std::align(alignof(slot), sizeof(slot), aligned, space);
+
+                    slot *s;
+                    try {
+                        s = new (aligned) slot(key);
+                    } catch (...) {
+                        allocator.deallocate(raw, bytes);
+                        throw;
+                    }
+
+                    return std::shared_ptr<slot>(s, [raw, bytes](slot *p) {
+                        p->~slot();
+                        secure_allocator<std::uint8_t>().deallocate(raw, bytes);
+                    });
+                }
+
+                typename lru_list::iterator find(std::uint64_t digest, const key_type &key) {
+                    std::pair<typename index_type::iterator, typename index_type::iterator> range =
+                        index.equal_range(digest);
+                    for (typename index_type::iterator it = range.first; it != range.second; ++it) {
+                        if (constant_time_compare(reinterpret_cast<const std::uint8_t *>((*it->second)->key.data()),
+                                                  reinterpret_cast<const std::uint8_t *>(key.data()), key_bytes)) {
+                            return it->second;
+                        }
+                    }
+                    return entries.end();
+                }
+
+                void evict(typename lru_list::iterator entry) {
+                    std::pair<typename index_type::iterator, typename index_type::iterator> range =
+                        index.equal_range(key_digest((*entry)->key));
+                    for (typename index_type::iterator it = range.first; it != range.second; ++it) {
+                        if (it->second == entry) {
+                            index.erase(it);
+                            break;
+                        }
+                    }
+                    entries.erase(entry);
+                }
+
+                std::uint64_t key_digest(const key_type &key) const {
+                    std::uint64_t h = salt;
+                    for (std::size_t i = 0; i != key.size(); ++i) {
+                        h ^= static_cast<std::uint64_t>(key[i]);
+                        h *= UINT64_C(0x9e3779b97f4a7c15);
+                        h ^= h >> 29;
+                    }
+                    return h;
+                }
+
+                static std::uint64_t random_salt() {
+                    std::random_device device;
+                    return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+                }
+
+                const std::size_t max_entries;
+                std::uint64_t hit_count, miss_count;
+                const std::uint64_t salt;
+
+                mutable std::mutex guard;
+                lru_list entries;
+                index_type index;
+            };
+        }    // namespace block
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_KEY_SCHEDULE_CACHE_HPP
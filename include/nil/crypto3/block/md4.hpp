@@ -87,7 +87,7 @@ namespace nil {
                 md4(const key_type &k) : key(k) {
                 }
 
-                virtual ~md4() {
+                ~md4() {
                     key.fill(0);
                 }
 
@@ -99,6 +99,18 @@ namespace nil {
                     return decrypt_block(key, ciphertext);
                 }
 
+                inline void encrypt_n(const block_type *plaintext, block_type *ciphertext, std::size_t n) const {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        ciphertext[i] = encrypt_block(key, plaintext[i]);
+                    }
+                }
+
+                inline void decrypt_n(const block_type *ciphertext, block_type *plaintext, std::size_t n) const {
+                    for (std::size_t i = 0; i != n; ++i) {
+                        plaintext[i] = decrypt_block(key, ciphertext[i]);
+                    }
+                }
+
             private:
                 key_type key;
 
@@ -26,6 +26,9 @@
 #ifndef CRYPTO3_BLOCK_RIJNDAEL_HPP
 #define CRYPTO3_BLOCK_RIJNDAEL_HPP
 
+#include <array>
+
+#include <boost/predef/architecture.h>
 #include <boost/range/adaptor/sliced.hpp>
 
 #include <nil/crypto3/block/detail/block_stream_processor.hpp>
@@ -33,8 +36,19 @@
 
 #include <nil/crypto3/block/detail/rijndael/rijndael_policy.hpp>
 #include <nil/crypto3/block/detail/rijndael/rijndael_impl.hpp>
+#include <nil/crypto3/block/detail/rijndael/rijndael_bitsliced_impl.hpp>
+#include <nil/crypto3/block/detail/rijndael/rijndael_ttable_impl.hpp>
+
+#if !defined(CRYPTO3_HAS_RIJNDAEL_NI) && !defined(CRYPTO3_HAS_RIJNDAEL_SSSE3) && \
+    !defined(CRYPTO3_RIJNDAEL_NO_RUNTIME_DISPATCH) && (BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64)
+#define CRYPTO3_HAS_RIJNDAEL_RUNTIME_DISPATCH
+#endif
+
+#if defined(CRYPTO3_HAS_RIJNDAEL_RUNTIME_DISPATCH)
+
+#include <nil/crypto3/block/detail/rijndael/rijndael_runtime_impl.hpp>
 
-#if defined(CRYPTO3_HAS_RIJNDAEL_NI)
+#elif defined(CRYPTO3_HAS_RIJNDAEL_NI)
 
 #include <nil/crypto3/block/detail/rijndael/rijndael_ni_impl.hpp>
 
@@ -59,6 +73,112 @@ namespace nil {
     namespace crypto3 {
         namespace block {
 
+            namespace detail {
+                /*!
+                 * @brief Picks the Rijndael implementation for the target, shared by rijndael and
+                 * rijndael_encryption.
+                 */
+                template<std::size_t KeyBits, std::size_t BlockBits>
+                struct rijndael_impl_selector {
+                    typedef rijndael_policy<KeyBits, BlockBits> policy_type;
+
+                    typedef typename std::conditional<
+                        BlockBits == 128 && (KeyBits == 128 || KeyBits == 192 || KeyBits == 256),
+#if defined(CRYPTO3_HAS_RIJNDAEL_RUNTIME_DISPATCH)
+                        rijndael_runtime_impl<KeyBits, BlockBits, policy_type>,
+#elif defined(CRYPTO3_HAS_RIJNDAEL_NI) && (BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64)
+                        rijndael_ni_impl<KeyBits, BlockBits>,
+#elif defined(CRYPTO3_HAS_RIJNDAEL_SSSE3) && \
+    ((BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSSE3_VERSION)
+                        rijndael_ssse3_impl<KeyBits, BlockBits, policy_type>,
+#elif defined(CRYPTO3_HAS_RIJNDAEL_ARMV8) || BOOST_ARCH_ARM >= BOOST_VERSION_NUMBER(8, 0, 0)
+                        rijndael_armv8_impl<KeyBits, BlockBits>,
+#elif defined(CRYPTO3_HAS_RIJNDAEL_POWER8) || (BOOST_ARCH_PPC >= BOOST_VERSION_NUMBER(8, 0, 0) || BOOST_ARCH_PPC_64)
+                        rijndael_power8_impl<KeyBits, BlockBits>,
+#else
+                        rijndael_bitsliced_impl<KeyBits, BlockBits>,
+#endif
+                        rijndael_ttable_impl<KeyBits, BlockBits>>::type type;
+                };
+
+                /*!
+                 * @brief Forward half shared by rijndael and rijndael_encryption: the cipher interface,
+                 * the implementation choice and the encryption key schedule.
+                 */
+                template<std::size_t KeyBits, std::size_t BlockBits>
+                class rijndael_encryption_base {
+                protected:
+                    BOOST_STATIC_ASSERT(KeyBits >= 128 && KeyBits <= 256 && KeyBits % 32 == 0);
+                    BOOST_STATIC_ASSERT(BlockBits >= 128 && BlockBits <= 256 && BlockBits % 32 == 0);
+
+                    constexpr static const std::size_t version = KeyBits;
+                    typedef rijndael_policy<KeyBits, BlockBits> policy_type;
+
+                    typedef typename rijndael_impl_selector<KeyBits, BlockBits>::type impl_type;
+
+                    constexpr static const std::size_t key_schedule_words = policy_type::key_schedule_words;
+                    constexpr static const std::size_t key_schedule_bytes = policy_type::key_schedule_bytes;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                public:
+                    constexpr static const std::size_t word_bits = policy_type::word_bits;
+                    constexpr static const std::size_t word_bytes = policy_type::word_bytes;
+                    typedef typename policy_type::word_type word_type;
+
+                    constexpr static const std::size_t key_bits = policy_type::key_bits;
+                    constexpr static const std::size_t key_words = policy_type::key_words;
+                    typedef typename policy_type::key_type key_type;
+
+                    constexpr static const std::size_t block_bits = policy_type::block_bits;
+                    constexpr static const std::size_t block_words = policy_type::block_words;
+                    typedef typename policy_type::block_type block_type;
+
+                    constexpr static const std::uint8_t rounds = policy_type::rounds;
+                    typedef typename policy_type::round_constants_type round_constants_type;
+
+                    template<class Mode, typename StateAccumulator, std::size_t ValueBits>
+                    struct stream_processor {
+                        struct params_type {
+                            constexpr static const std::size_t value_bits = ValueBits;
+                            constexpr static const std::size_t length_bits = policy_type::word_bits * 2;
+                        };
+
+                        typedef block_stream_processor<Mode, StateAccumulator, params_type> type;
+                    };
+
+                    typedef typename stream_endian::little_octet_big_bit endian_type;
+
+                    inline block_type encrypt(const block_type &plaintext) const {
+                        return impl_type::encrypt_block(plaintext, encryption_key);
+                    }
+
+                    /*!
+                     * @brief Encrypts n contiguous independent blocks at once. Hardware-accelerated
+                     * implementations keep several blocks in flight to hide instruction latency
+                     * (eight with AES-NI, four with SSSE3, eight with VAES on AVX2 and sixteen on AVX-512).
+                     */
+                    inline void encrypt_n(const block_type *plaintext, block_type *ciphertext, std::size_t n) const {
+                        impl_type::encrypt_blocks(plaintext, ciphertext, n, encryption_key);
+                    }
+
+                protected:
+                    constexpr static const std::size_t schedule_batch = 8;
+
+                    rijndael_encryption_base() : encryption_key({0}) {
+                    }
+
+                    explicit rijndael_encryption_base(const key_schedule_type &encryption_schedule) :
+                        encryption_key(encryption_schedule) {
+                    }
+
+                    ~rijndael_encryption_base() {
+                        encryption_key.fill(0);
+                    }
+
+                    alignas(policy_type::key_schedule_alignment) key_schedule_type encryption_key;
+                };
+            }    // namespace detail
+
             /*!
              * @brief Rijndael. AES competition winner.
              *
@@ -77,26 +197,14 @@ namespace nil {
              * systems with SSSE3 but without AES-NI, crypto3 has an implementation which avoids
              * known side channels.
              *
-             * This implementation is intended to be based on table lookups which
-             * are known to be vulnerable to timing and cache based side channel
-             * attacks. Some countermeasures are used which may be helpful in some
-             * situations:
-             *
-             * - Only a single 256-word T-table is used, with rotations applied.
-             *   Most implementations use 4 T-tables which leaks much more
-             *   information via cache usage.
+             * Without hardware support the 128-bit block variants use a bitsliced
+             * implementation which processes four blocks at once with no table lookups
+             * and no secret-dependent branches or memory accesses. The larger block
+             * variants use a word-oriented T-table implementation, which is not
+             * constant-time.
              *
-             * - The TE and TD tables are computed at runtime to avoid flush+reload
-             *   attacks using clflush. As different processes will not share the
-             *   same underlying table data, an attacker can't manipulate another
-             *   processes cache lines via their shared reference to the library
-             *   read only segment.
-             *
-             * - Each cache line of the lookup tables is accessed at the beginning
-             *   of each call to encrypt or decrypt. (See the Z variable below)
-             *
-             * If available SSSE3 or AES-NI are used instead of this version, as both
-             * are faster and immune to side channel attacks.
+             * If available SSSE3 or AES-NI are used instead, as both are faster and
+             * immune to side channel attacks.
              *
              * Some AES cache timing papers for reference:
              *
@@ -109,86 +217,132 @@ namespace nil {
              * [Cache-Collision Timing Attacks Against AES. Bonneau,
              * Mironov](http://citeseerx.ist.psu.edu/viewdoc/summary?doi=10.1.1.88.4753)
              *
+             * On x86 targets built without CRYPTO3_HAS_RIJNDAEL_NI or CRYPTO3_HAS_RIJNDAEL_SSSE3 the
+             * 128-bit block variants pick VAES, AES-NI, SSSE3 or the bitsliced implementation at runtime
+             * from cpuid. Define CRYPTO3_RIJNDAEL_NO_RUNTIME_DISPATCH to always use the bitsliced one.
+             *
              * @tparam KeyBits Key length used in bits. Available values are: 128, 192, 256
              * @tparam BlockBits Block length used in bits. Available values are: 128, 192, 256
              */
             template<std::size_t KeyBits, std::size_t BlockBits>
-            class rijndael {
+            class rijndael : public detail::rijndael_encryption_base<KeyBits, BlockBits> {
+                typedef detail::rijndael_encryption_base<KeyBits, BlockBits> base_type;
 
-                BOOST_STATIC_ASSERT(KeyBits >= 128 && KeyBits <= 256 && KeyBits % 32 == 0);
-                BOOST_STATIC_ASSERT(BlockBits >= 128 && BlockBits <= 256 && BlockBits % 32 == 0);
+                typedef typename base_type::policy_type policy_type;
+                typedef typename base_type::impl_type impl_type;
+                typedef typename base_type::key_schedule_type key_schedule_type;
 
-                constexpr static const std::size_t version = KeyBits;
-                typedef detail::rijndael_policy<KeyBits, BlockBits> policy_type;
+                using base_type::schedule_batch;
 
-                typedef
-                    typename std::conditional<BlockBits == 128 && (KeyBits == 128 || KeyBits == 192 || KeyBits == 256),
-#if defined(CRYPTO3_HAS_RIJNDAEL_NI) && (BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64)
-                                              detail::rijndael_ni_impl<KeyBits, BlockBits>,
-#elif defined(CRYPTO3_HAS_RIJNDAEL_SSSE3) && \
-    ((BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSSE3_VERSION)
-                                              detail::rijndael_ssse3_impl<KeyBits, BlockBits>,
-#elif defined(CRYPTO3_HAS_RIJNDAEL_ARMV8) || BOOST_ARCH_ARM >= BOOST_VERSION_NUMBER(8, 0, 0)
-                                              detail::rijndael_armv8_impl<KeyBits, BlockBits>,
-#elif defined(CRYPTO3_HAS_RIJNDAEL_POWER8) || (BOOST_ARCH_PPC >= BOOST_VERSION_NUMBER(8, 0, 0) || BOOST_ARCH_PPC_64)
-                                              detail::rijndael_power8_impl<KeyBits, BlockBits>,
-#else
-                                              detail::rijndael_impl<KeyBits, BlockBits>,
-#endif
-                                              detail::rijndael_impl<KeyBits, BlockBits>>::type impl_type;
+            public:
+                typedef typename base_type::key_type key_type;
+                typedef typename base_type::block_type block_type;
 
-                constexpr static const std::size_t key_schedule_words = policy_type::key_schedule_words;
-                constexpr static const std::size_t key_schedule_bytes = policy_type::key_schedule_bytes;
-                typedef typename policy_type::key_schedule_type key_schedule_type;
+                rijndael(const key_type &key) : decryption_key({0}) {
+                    impl_type::schedule_key(key, this->encryption_key, decryption_key);
+                }
 
-            public:
-                constexpr static const std::size_t word_bits = policy_type::word_bits;
-                constexpr static const std::size_t word_bytes = policy_type::word_bytes;
-                typedef typename policy_type::word_type word_type;
-
-                constexpr static const std::size_t key_bits = policy_type::key_bits;
-                constexpr static const std::size_t key_words = policy_type::key_words;
-                //                typedef typename policy_type::key_schedule_word_type key_schedule_word_type;
-                typedef typename policy_type::key_type key_type;
-
-                constexpr static const std::size_t block_bits = policy_type::block_bits;
-                constexpr static const std::size_t block_words = policy_type::block_words;
-                typedef typename policy_type::block_type block_type;
-
-                constexpr static const std::uint8_t rounds = policy_type::rounds;
-                typedef typename policy_type::round_constants_type round_constants_type;
-
-                template<class Mode, typename StateAccumulator, std::size_t ValueBits>
-                struct stream_processor {
-                    struct params_type {
-                        constexpr static const std::size_t value_bits = ValueBits;
-                        constexpr static const std::size_t length_bits = policy_type::word_bits * 2;
-                    };
+                ~rijndael() {
+                    decryption_key.fill(0);
+                }
 
-                    typedef block_stream_processor<Mode, StateAccumulator, params_type> type;
-                };
+                inline block_type decrypt(const block_type &plaintext) const {
+                    return impl_type::decrypt_block(plaintext, decryption_key);
+                }
 
-                typedef typename stream_endian::little_octet_big_bit endian_type;
+                inline void decrypt_n(const block_type *ciphertext, block_type *plaintext, std::size_t n) const {
+                    impl_type::decrypt_blocks(ciphertext, plaintext, n, decryption_key);
+                }
 
-                rijndael(const key_type &key) : encryption_key({0}), decryption_key({0}) {
-                    impl_type::schedule_key(key, encryption_key, decryption_key);
+                /*!
+                 * @brief Keys one cipher per key and writes them to out. With AES-NI or SSSE3 the key
+                 * schedules of several keys are expanded side by side, which is several times faster
+                 * than constructing the ciphers one by one.
+                 */
+                template<typename OutputIterator>
+                static OutputIterator schedule_keys(const key_type *keys, std::size_t n, OutputIterator out) {
+                    std::array<key_schedule_type, schedule_batch> encryption_keys, decryption_keys;
+
+                    for (std::size_t i = 0; i < n; i += schedule_batch) {
+                        const std::size_t m = n - i < schedule_batch ? n - i : schedule_batch;
+                        impl_type::schedule_keys(keys + i, m, encryption_keys.data(), decryption_keys.data());
+                        for (std::size_t j = 0; j != m; ++j) {
+                            *out++ = rijndael(encryption_keys[j], decryption_keys[j]);
+                        }
+                    }
+
+                    for (std::size_t j = 0; j != schedule_batch; ++j) {
+                        encryption_keys[j].fill(0);
+                        decryption_keys[j].fill(0);
+                    }
+
+                    return out;
                 }
 
-                virtual ~rijndael() {
-                    encryption_key.fill(0);
-                    decryption_key.fill(0);
+            protected:
+                rijndael(const key_schedule_type &encryption_schedule, const key_schedule_type &decryption_schedule) :
+                    base_type(encryption_schedule), decryption_key(decryption_schedule) {
                 }
 
-                inline block_type encrypt(const block_type &plaintext) const {
-                    return impl_type::encrypt_block(plaintext, encryption_key);
+                alignas(policy_type::key_schedule_alignment) key_schedule_type decryption_key;
+            };
+
+            /*!
+             * @brief Encryption-only Rijndael.
+             *
+             * @ingroup block
+             *
+             * Same cipher and implementation as rijndael, but only the forward key schedule is
+             * expanded and kept. Modes which never run the inverse cipher (CTR, GCM, GCM-SIV, CCM,
+             * CFB, OFB) lose nothing, while key setup skips the InvMixColumns pass over the round
+             * keys and the object holds half the schedule memory.
+             *
+             * @tparam KeyBits Key length used in bits. Available values are: 128, 192, 256
+             * @tparam BlockBits Block length used in bits. Available values are: 128, 192, 256
+             */
+            template<std::size_t KeyBits, std::size_t BlockBits>
+            class rijndael_encryption : public detail::rijndael_encryption_base<KeyBits, BlockBits> {
+                typedef detail::rijndael_encryption_base<KeyBits, BlockBits> base_type;
+
+                typedef typename base_type::impl_type impl_type;
+                typedef typename base_type::key_schedule_type key_schedule_type;
+
+                using base_type::schedule_batch;
+
+            public:
+                typedef typename base_type::key_type key_type;
+
+                rijndael_encryption(const key_type &key) {
+                    impl_type::schedule_encryption_key(key, this->encryption_key);
                 }
 
-                inline block_type decrypt(const block_type &plaintext) const {
-                    return impl_type::decrypt_block(plaintext, decryption_key);
+                /*!
+                 * @brief Keys one cipher per key and writes them to out, expanding several key
+                 * schedules side by side where the implementation supports it.
+                 */
+                template<typename OutputIterator>
+                static OutputIterator schedule_keys(const key_type *keys, std::size_t n, OutputIterator out) {
+                    std::array<key_schedule_type, schedule_batch> encryption_keys;
+
+                    for (std::size_t i = 0; i < n; i += schedule_batch) {
+                        const std::size_t m = n - i < schedule_batch ? n - i : schedule_batch;
+                        impl_type::schedule_encryption_keys(keys + i, m, encryption_keys.data());
+                        for (std::size_t j = 0; j != m; ++j) {
+                            *out++ = rijndael_encryption(encryption_keys[j]);
+                        }
+                    }
+
+                    for (std::size_t j = 0; j != schedule_batch; ++j) {
+                        encryption_keys[j].fill(0);
+                    }
+
+                    return out;
                 }
 
             protected:
-                key_schedule_type encryption_key, decryption_key;
+                explicit rijndael_encryption(const key_schedule_type &encryption_schedule) :
+                    base_type(encryption_schedule) {
+                }
             };
         }    // namespace block
     }        // namespace crypto3
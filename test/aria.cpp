@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#define BOOST_TEST_MODULE aria_cipher_test
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/block/algorithm/encrypt.hpp>
+#include <nil/crypto3/block/algorithm/decrypt.hpp>
+
+#include <nil/crypto3/block/aria.hpp>
+
+#include "batch_test.hpp"
+
+using namespace nil::crypto3;
+
+namespace {
+    const std::vector<char> rfc5794_key = {'\x00', '\x01', '\x02', '\x03', '\x04', '\x05', '\x06', '\x07',
+                                           '\x08', '\x09', '\x0a', '\x0b', '\x0c', '\x0d', '\x0e', '\x0f',
+                                           '\x10', '\x11', '\x12', '\x13', '\x14', '\x15', '\x16', '\x17',
+                                           '\x18', '\x19', '\x1a', '\x1b', '\x1c', '\x1d', '\x1e', '\x1f'};
+
+    const std::vector<char> rfc5794_plaintext = {'\x00', '\x11', '\x22', '\x33', '\x44', '\x55', '\x66', '\x77',
+                                                 '\x88', '\x99', '\xaa', '\xbb', '\xcc', '\xdd', '\xee', '\xff'};
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(aria_test_suite)
+
+// RFC 5794, appendix A
+BOOST_AUTO_TEST_CASE(aria_128) {
+    std::string out = encrypt<block::aria<128>>(rfc5794_plaintext,
+                                                std::vector<char>(rfc5794_key.begin(), rfc5794_key.begin() + 16));
+
+    BOOST_CHECK_EQUAL(out, "d718fbd6ab644c739da95f3be6451778");
+}
+
+BOOST_AUTO_TEST_CASE(aria_192) {
+    std::string out = encrypt<block::aria<192>>(rfc5794_plaintext,
+                                                std::vector<char>(rfc5794_key.begin(), rfc5794_key.begin() + 24));
+
+    BOOST_CHECK_EQUAL(out, "26449c1805dbe7aa25a468ce263a9e79");
+}
+
+BOOST_AUTO_TEST_CASE(aria_256) {
+    std::string out = encrypt<block::aria<256>>(rfc5794_plaintext, rfc5794_key);
+
+    BOOST_CHECK_EQUAL(out, "f92bd7c79fb72e2f2b8f80c1972d24fc");
+}
+
+BOOST_AUTO_TEST_CASE(aria_128_decrypt) {
+    std::vector<char> input = {'\xd7', '\x18', '\xfb', '\xd6', '\xab', '\x64', '\x4c', '\x73',
+                               '\x9d', '\xa9', '\x5f', '\x3b', '\xe6', '\x45', '\x17', '\x78'};
+
+    std::string out = decrypt<block::aria<128>>(
+        input, std::vector<char>(rfc5794_key.begin(), rfc5794_key.begin() + 16));
+
+    BOOST_CHECK_EQUAL(out, "00112233445566778899aabbccddeeff");
+}
+
+// Batches of 32 and 16 and single-block tails
+BOOST_AUTO_TEST_CASE(aria_batches_match_single_blocks) {
+    check_batches<block::aria<128>>(53);
+    check_batches<block::aria<192>>(53);
+    check_batches<block::aria<256>>(53);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE camellia_cipher_test
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/block/algorithm/encrypt.hpp>
+#include <nil/crypto3/block/algorithm/decrypt.hpp>
+
+#include <nil/crypto3/block/camellia.hpp>
+
+#include "batch_test.hpp"
+
+using namespace nil::crypto3;
+
+namespace {
+    const std::vector<char> rfc3713_key = {'\x01', '\x23', '\x45', '\x67', '\x89', '\xab', '\xcd', '\xef',
+                                           '\xfe', '\xdc', '\xba', '\x98', '\x76', '\x54', '\x32', '\x10',
+                                           '\x00', '\x11', '\x22', '\x33', '\x44', '\x55', '\x66', '\x77',
+                                           '\x88', '\x99', '\xaa', '\xbb', '\xcc', '\xdd', '\xee', '\xff'};
+
+    const std::vector<char> rfc3713_plaintext(rfc3713_key.begin(), rfc3713_key.begin() + 16);
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(camellia_test_suite)
+
+// RFC 3713, appendix A
+BOOST_AUTO_TEST_CASE(camellia_128) {
+    std::string out = encrypt<block::camellia<128>>(
+        rfc3713_plaintext, std::vector<char>(rfc3713_key.begin(), rfc3713_key.begin() + 16));
+
+    BOOST_CHECK_EQUAL(out, "67673138549669730857065648eabe43");
+}
+
+BOOST_AUTO_TEST_CASE(camellia_192) {
+    std::string out = encrypt<block::camellia<192>>(
+        rfc3713_plaintext, std::vector<char>(rfc3713_key.begin(), rfc3713_key.begin() + 24));
+
+    BOOST_CHECK_EQUAL(out, "b4993401b3e996f84ee5cee7d79b09b9");
+}
+
+BOOST_AUTO_TEST_CASE(camellia_256) {
+    std::string out = encrypt<block::camellia<256>>(rfc3713_plaintext, rfc3713_key);
+
+    BOOST_CHECK_EQUAL(out, "9acc237dff16d76c20ef7c919e3a7509");
+}
+
+BOOST_AUTO_TEST_CASE(camellia_256_decrypt) {
+    std::vector<char> input = {'\x9a', '\xcc', '\x23', '\x7d', '\xff', '\x16', '\xd7', '\x6c',
+                               '\x20', '\xef', '\x7c', '\x91', '\x9e', '\x3a', '\x75', '\x09'};
+
+    std::string out = decrypt<block::camellia<256>>(input, rfc3713_key);
+
+    BOOST_CHECK_EQUAL(out, "0123456789abcdeffedcba9876543210");
+}
+
+// Whole batches of 16 and single-block tails
+BOOST_AUTO_TEST_CASE(camellia_batches_match_single_blocks) {
+    check_batches<block::camellia<128>>(37);
+    check_batches<block::camellia<192>>(37);
+    check_batches<block::camellia<256>>(37);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
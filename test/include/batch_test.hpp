@@ -0,0 +1,67 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_BLOCK_TEST_BATCH_TEST_HPP
+#define CRYPTO3_BLOCK_TEST_BATCH_TEST_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+/*!
+ * @brief Checks encrypt_n against encrypt and decrypt_n against the input for every length from
+ * one block up to max_blocks, so that each batch width of the cipher's kernels is run whole and
+ * with a tail. Key and block words are filled with distinct values of whatever width the cipher
+ * uses.
+ */
+template<typename Cipher>
+void check_batches(std::size_t max_blocks) {
+    typedef typename Cipher::block_type block_type;
+    typedef typename Cipher::key_type key_type;
+
+    key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<typename key_type::value_type>(0x0123456789abcdefULL * (i + 1));
+    }
+    const Cipher cipher(key);
+
+    std::vector<block_type> in(max_blocks), out(in.size()), back(in.size());
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        for (std::size_t j = 0; j != in[i].size(); ++j) {
+            in[i][j] = static_cast<typename block_type::value_type>(0x9e3779b97f4a7c15ULL * (i * in[i].size() + j + 1));
+        }
+    }
+
+    for (std::size_t n = 1; n <= in.size(); ++n) {
+        cipher.encrypt_n(in.data(), out.data(), n);
+        cipher.decrypt_n(out.data(), back.data(), n);
+        for (std::size_t i = 0; i != n; ++i) {
+            BOOST_CHECK(out[i] == cipher.encrypt(in[i]));
+            BOOST_CHECK(back[i] == in[i]);
+        }
+    }
+}
+
+#endif    // CRYPTO3_BLOCK_TEST_BATCH_TEST_HPP
@@ -0,0 +1,151 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE key_schedule_cache_test
+
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/block/aes.hpp>
+#include <nil/crypto3/block/kasumi.hpp>
+#include <nil/crypto3/block/shacal2.hpp>
+
+#include <nil/crypto3/block/key_schedule_cache.hpp>
+
+using namespace nil::crypto3;
+
+template<typename Cipher>
+typename Cipher::key_type make_key(std::size_t seed) {
+    typename Cipher::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<typename Cipher::key_type::value_type>(seed * 131 + i);
+    }
+    return key;
+}
+
+template<typename Cipher>
+typename Cipher::block_type make_block(std::size_t seed) {
+    typename Cipher::block_type block;
+    for (std::size_t i = 0; i != block.size(); ++i) {
+        block[i] = static_cast<typename Cipher::block_type::value_type>(seed * 7 + i);
+    }
+    return block;
+}
+
+BOOST_AUTO_TEST_SUITE(key_schedule_cache_test_suite)
+
+BOOST_AUTO_TEST_CASE(rejects_zero_capacity) {
+    BOOST_CHECK_THROW(block::key_schedule_cache<block::aes<128>>(0), std::invalid_argument);
+}
+
+// Repeated keys come back as the same cached object, and the cached cipher behaves like a fresh one
+BOOST_AUTO_TEST_CASE(aes_256_hits_and_misses) {
+    typedef block::aes<256> cipher_type;
+    block::key_schedule_cache<cipher_type> cache(4);
+
+    cipher_type::key_type key = make_key<cipher_type>(1);
+    block::key_schedule_cache<cipher_type>::pointer first = cache.get(key);
+    block::key_schedule_cache<cipher_type>::pointer second = cache.get(key);
+
+    BOOST_CHECK(first.get() == second.get());
+    BOOST_CHECK_EQUAL(cache.hits(), 1);
+    BOOST_CHECK_EQUAL(cache.misses(), 1);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+
+    cipher_type::block_type plaintext = make_block<cipher_type>(3);
+    BOOST_CHECK(first->encrypt(plaintext) == cipher_type(key).encrypt(plaintext));
+    BOOST_CHECK(first->decrypt(first->encrypt(plaintext)) == plaintext);
+
+    cache.get(make_key<cipher_type>(2));
+    BOOST_CHECK_EQUAL(cache.misses(), 2);
+    BOOST_CHECK_EQUAL(cache.size(), 2);
+
+    cache.erase(key);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+    BOOST_CHECK(cache.get(key).get() != first.get());
+    BOOST_CHECK_EQUAL(cache.misses(), 3);
+}
+
+// The least recently used key goes first, and holders of an evicted entry keep a working cipher
+BOOST_AUTO_TEST_CASE(kasumi_lru_eviction) {
+    typedef block::kasumi cipher_type;
+    block::key_schedule_cache<cipher_type> cache(2);
+
+    block::key_schedule_cache<cipher_type>::pointer a = cache.get(make_key<cipher_type>(1));
+    cache.get(make_key<cipher_type>(2));
+    cache.get(make_key<cipher_type>(1));
+    cache.get(make_key<cipher_type>(3));
+
+    BOOST_CHECK_EQUAL(cache.size(), 2);
+    BOOST_CHECK_EQUAL(cache.hits(), 1);
+
+    cache.get(make_key<cipher_type>(1));
+    BOOST_CHECK_EQUAL(cache.hits(), 2);
+    cache.get(make_key<cipher_type>(2));
+    BOOST_CHECK_EQUAL(cache.misses(), 4);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0);
+
+    cipher_type::block_type plaintext = make_block<cipher_type>(5);
+    BOOST_CHECK(a->encrypt(plaintext) == cipher_type(make_key<cipher_type>(1)).encrypt(plaintext));
+}
+
+BOOST_AUTO_TEST_CASE(shacal2_concurrent_lookups) {
+    typedef block::shacal2<256> cipher_type;
+    block::key_schedule_cache<cipher_type> cache(3);
+
+    const cipher_type::block_type plaintext = make_block<cipher_type>(9);
+    std::vector<cipher_type::block_type> expected;
+    for (std::size_t k = 0; k != 5; ++k) {
+        expected.push_back(cipher_type(make_key<cipher_type>(k)).encrypt(plaintext));
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+    for (std::size_t t = 0; t != failures.size(); ++t) {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = 0; i != 200; ++i) {
+                std::size_t k = (i * (t + 1)) % expected.size();
+                if (cache.get(make_key<cipher_type>(k))->encrypt(plaintext) != expected[k]) {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    for (int failed : failures) {
+        BOOST_CHECK_EQUAL(failed, 0);
+    }
+    BOOST_CHECK_EQUAL(cache.hits() + cache.misses(), 800);
+    BOOST_CHECK(cache.size() <= cache.capacity());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
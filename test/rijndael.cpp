@@ -27,6 +27,7 @@
 
 #include <iostream>
 #include <cstdint>
+#include <list>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -44,6 +45,8 @@
 #include <nil/crypto3/block/aes.hpp>
 #include <nil/crypto3/block/rijndael.hpp>
 
+#include "batch_test.hpp"
+
 using namespace nil::crypto3;
 using namespace nil::crypto3::block;
 using namespace nil::crypto3::detail;
@@ -308,6 +311,84 @@ BOOST_DATA_TEST_CASE(rijndael_256_128, string_data("key_256_block_128"), triples
     }
 }
 
+BOOST_DATA_TEST_CASE(rijndael_128_192, string_data("key_128_block_192"), triples) {
+
+    byte_string const p(triples.first);
+
+    BOOST_FOREACH (boost::property_tree::ptree::value_type pair, triples.second) {
+        byte_string const k(pair.first);
+
+        std::string out = encrypt<block::rijndael<128, 192>>(p, k);
+
+        BOOST_CHECK_EQUAL(out, pair.second.data());
+    }
+}
+
+BOOST_DATA_TEST_CASE(rijndael_192_192, string_data("key_192_block_192"), triples) {
+
+    byte_string const p(triples.first);
+
+    BOOST_FOREACH (boost::property_tree::ptree::value_type pair, triples.second) {
+        byte_string const k(pair.first);
+
+        std::string out = encrypt<block::rijndael<192, 192>>(p, k);
+
+        BOOST_CHECK_EQUAL(out, pair.second.data());
+    }
+}
+
+BOOST_DATA_TEST_CASE(rijndael_256_192, string_data("key_256_block_192"), triples) {
+
+    byte_string const p(triples.first);
+
+    BOOST_FOREACH (boost::property_tree::ptree::value_type pair, triples.second) {
+        byte_string const k(pair.first);
+
+        std::string out = encrypt<block::rijndael<256, 192>>(p, k);
+
+        BOOST_CHECK_EQUAL(out, pair.second.data());
+    }
+}
+
+BOOST_DATA_TEST_CASE(rijndael_128_256, string_data("key_128_block_256"), triples) {
+
+    byte_string const p(triples.first);
+
+    BOOST_FOREACH (boost::property_tree::ptree::value_type pair, triples.second) {
+        byte_string const k(pair.first);
+
+        std::string out = encrypt<block::rijndael<128, 256>>(p, k);
+
+        BOOST_CHECK_EQUAL(out, pair.second.data());
+    }
+}
+
+BOOST_DATA_TEST_CASE(rijndael_192_256, string_data("key_192_block_256"), triples) {
+
+    byte_string const p(triples.first);
+
+    BOOST_FOREACH (boost::property_tree::ptree::value_type pair, triples.second) {
+        byte_string const k(pair.first);
+
+        std::string out = encrypt<block::rijndael<192, 256>>(p, k);
+
+        BOOST_CHECK_EQUAL(out, pair.second.data());
+    }
+}
+
+BOOST_DATA_TEST_CASE(rijndael_256_256, string_data("key_256_block_256"), triples) {
+
+    byte_string const p(triples.first);
+
+    BOOST_FOREACH (boost::property_tree::ptree::value_type pair, triples.second) {
+        byte_string const k(pair.first);
+
+        std::string out = encrypt<block::rijndael<256, 256>>(p, k);
+
+        BOOST_CHECK_EQUAL(out, pair.second.data());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*  NIST SP 800-38A AES tests
@@ -385,6 +466,1298 @@ BOOST_AUTO_TEST_CASE(aes_256_cipher) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(rijndael_batch_test_suite)
+
+// Batch entry points have to agree with the per-block ones across full and partial interleave groups
+BOOST_AUTO_TEST_CASE(aes_128_batch) {
+    check_batches<block::aes<128>>(19);
+}
+
+BOOST_AUTO_TEST_CASE(aes_192_batch) {
+    check_batches<block::aes<192>>(19);
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_batch) {
+    check_batches<block::aes<256>>(19);
+}
+
+BOOST_AUTO_TEST_CASE(rijndael_128_192_batch) {
+    check_batches<block::rijndael<128, 192>>(19);
+}
+
+BOOST_AUTO_TEST_CASE(rijndael_256_256_batch) {
+    check_batches<block::rijndael<256, 256>>(19);
+}
+
+// Ciphers keyed in one batch behave like ones constructed key by key
+template<typename Cipher>
+void check_schedule_keys() {
+    std::vector<typename Cipher::key_type> keys(19);
+    for (std::size_t k = 0; k != keys.size(); ++k) {
+        for (std::size_t i = 0; i != keys[k].size(); ++i) {
+            keys[k][i] = static_cast<typename Cipher::key_type::value_type>(k * 59 + i);
+        }
+    }
+
+    std::vector<Cipher> ciphers;
+    Cipher::schedule_keys(keys.data(), keys.size(), std::back_inserter(ciphers));
+    BOOST_REQUIRE_EQUAL(ciphers.size(), keys.size());
+
+    typename Cipher::block_type block;
+    for (std::size_t i = 0; i != block.size(); ++i) {
+        block[i] = static_cast<typename Cipher::block_type::value_type>(i * 3);
+    }
+    for (std::size_t k = 0; k != keys.size(); ++k) {
+        BOOST_CHECK(ciphers[k].encrypt(block) == Cipher(keys[k]).encrypt(block));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(aes_schedule_keys) {
+    check_schedule_keys<block::aes<128>>();
+    check_schedule_keys<block::aes<192>>();
+    check_schedule_keys<block::aes<256>>();
+    check_schedule_keys<block::aes_encryption<256>>();
+    check_schedule_keys<block::rijndael<192, 256>>();
+
+    std::vector<block::aes<128>> ciphers;
+    block::aes<128>::schedule_keys(nullptr, 0, std::back_inserter(ciphers));
+    BOOST_CHECK(ciphers.empty());
+}
+
+// The encryption-only variant expands the same forward schedule with half the state
+BOOST_AUTO_TEST_CASE(rijndael_encryption_matches_rijndael) {
+    BOOST_STATIC_ASSERT(sizeof(block::aes_encryption<128>) < sizeof(block::aes<128>));
+
+    block::rijndael<256, 256>::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(5 * i + 2);
+    }
+
+    block::rijndael<256, 256> cipher(key);
+    block::rijndael_encryption<256, 256> encryption_only(key);
+
+    std::vector<block::rijndael<256, 256>::block_type> in(11), out(in.size()), expected(in.size());
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        for (std::size_t j = 0; j != in[i].size(); ++j) {
+            in[i][j] = static_cast<std::uint8_t>(i * 29 + j);
+        }
+    }
+
+    cipher.encrypt_n(in.data(), expected.data(), in.size());
+    encryption_only.encrypt_n(in.data(), out.data(), in.size());
+    BOOST_CHECK(out == expected);
+    BOOST_CHECK(encryption_only.encrypt(in[3]) == expected[3]);
+}
+
+// Cipher contexts carry no vtable, and an accumulator keyed directly holds the only key schedule
+BOOST_AUTO_TEST_CASE(aes_context_keyed_in_place) {
+    BOOST_STATIC_ASSERT(!std::is_polymorphic<block::aes<128>>::value);
+    BOOST_STATIC_ASSERT(!std::is_polymorphic<block::aes_encryption<256>>::value);
+    BOOST_STATIC_ASSERT(sizeof(block::aes<128>) % block::detail::aes_policy<128>::key_schedule_alignment == 0);
+
+    typedef block::aes<128> cipher_type;
+    typedef block::modes::isomorphic<cipher_type, block::nop_padding>::bind<
+        block::encryption_policy<cipher_type>>::type mode_type;
+
+    cipher_type::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i);
+    }
+    const cipher_type::block_type plaintext = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                               0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+
+    const mode_type mode {cipher_type(key)};
+    block::accumulator_set<mode_type> keyed(key), copied(mode);
+    keyed(plaintext);
+    copied(plaintext);
+    BOOST_CHECK(accumulators::extract::block<mode_type>(keyed) == accumulators::extract::block<mode_type>(copied));
+
+    std::vector<std::uint8_t> out;
+    encrypt<cipher_type>(plaintext, key, std::back_inserter(out));
+    BOOST_CHECK(std::equal(out.begin(), out.end(), cipher_type(key).encrypt(plaintext).begin()));
+}
+
+struct long_message_fixture {
+    typedef block::aes<128> cipher_type;
+
+    long_message_fixture() : blocks(4100) {
+        for (std::size_t i = 0; i != key.size(); ++i) {
+            key[i] = static_cast<cipher_type::key_type::value_type>(i);
+        }
+
+        for (std::size_t i = 0; i != blocks.size(); ++i) {
+            for (std::size_t j = 0; j != blocks[i].size(); ++j) {
+                blocks[i][j] = static_cast<std::uint8_t>(i ^ (j * 7));
+                input.push_back(blocks[i][j]);
+            }
+        }
+
+        std::vector<cipher_type::block_type> ciphertext(blocks.size());
+        cipher_type(key).encrypt_n(blocks.data(), ciphertext.data(), blocks.size());
+        for (std::size_t i = 0; i != ciphertext.size(); ++i) {
+            expected.insert(expected.end(), ciphertext[i].begin(), ciphertext[i].end());
+        }
+    }
+
+    cipher_type::key_type key;
+    std::vector<cipher_type::block_type> blocks;
+    std::vector<std::uint8_t> input, expected;
+};
+
+// Long contiguous input goes through the accumulator with its output reserved up front
+BOOST_FIXTURE_TEST_CASE(aes_128_long_message, long_message_fixture) {
+    std::vector<std::uint8_t> out = encrypt<cipher_type>(input, key);
+
+    BOOST_CHECK(out == expected);
+}
+
+// Input split at non-block boundaries mixes cached head/tail values with directly packed blocks
+BOOST_FIXTURE_TEST_CASE(aes_128_long_message_unaligned_updates, long_message_fixture) {
+    typedef modes::isomorphic<cipher_type, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+
+    cipher_type cipher(key);
+    encryption_mode mode(cipher);
+    block::accumulator_set<encryption_mode> acc(mode);
+
+    {
+        cipher_type::stream_processor<encryption_mode, block::accumulator_set<encryption_mode>, 8>::type sp(acc);
+        sp(input.begin(), input.begin() + 5);
+        sp(input.begin() + 5, input.begin() + 1003);
+        sp(input.begin() + 1003, input.end());
+    }
+
+    digest<128> out = accumulators::extract::block<encryption_mode>(acc);
+
+    BOOST_CHECK(std::vector<std::uint8_t>(out.begin(), out.end()) == expected);
+}
+
+// Output iterators receive the ciphertext in chunks while the input is consumed
+BOOST_FIXTURE_TEST_CASE(aes_128_long_message_output_iterator, long_message_fixture) {
+    std::vector<std::uint8_t> out;
+    encrypt<cipher_type>(input.begin(), input.end(), key, std::back_inserter(out));
+
+    BOOST_CHECK(out == expected);
+
+    std::list<std::uint8_t> input_list(input.begin(), input.end()), out_list;
+    encrypt<cipher_type>(input_list.begin(), input_list.end(), key, std::back_inserter(out_list));
+
+    BOOST_CHECK(std::vector<std::uint8_t>(out_list.begin(), out_list.end()) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(aes_ctr_test_suite)
+
+typedef modes::ctr<block::aes<128>, block::nop_padding> aes_128_ctr_mode;
+typedef aes_128_ctr_mode::bind<aes_128_ctr_mode::encryption_policy>::type aes_128_ctr_encryption;
+typedef aes_128_ctr_mode::bind<aes_128_ctr_mode::decryption_policy>::type aes_128_ctr_decryption;
+
+template<typename Mode>
+std::string ctr_process(const Mode &mode, const byte_string &input) {
+    block::accumulator_set<Mode> acc(mode);
+
+    {
+        typename block::aes<128>::stream_processor<Mode, block::accumulator_set<Mode>, 8>::type sp(acc);
+        sp(input.begin(), input.end());
+    }
+
+    return std::to_string(accumulators::extract::block<Mode>(acc));
+}
+
+block::aes<128>::key_type ctr_key(const std::string &hex) {
+    byte_string b(hex);
+    block::aes<128>::key_type key = {0};
+    std::copy(b.begin(), b.end(), key.begin());
+    return key;
+}
+
+block::aes<128>::block_type ctr_iv(const std::string &hex) {
+    byte_string b(hex);
+    block::aes<128>::block_type iv = {0};
+    std::copy(b.begin(), b.end(), iv.begin());
+    return iv;
+}
+
+// F.5.1, F.5.2
+BOOST_AUTO_TEST_CASE(aes_128_ctr) {
+    std::string input =
+        "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+        "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+    std::string output =
+        "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+        "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee";
+
+    block::aes<128> cipher(ctr_key("2b7e151628aed2a6abf7158809cf4f3c"));
+    block::aes<128>::block_type iv = ctr_iv("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+
+    BOOST_CHECK_EQUAL(ctr_process(aes_128_ctr_encryption(cipher, iv), byte_string(input)), output);
+    BOOST_CHECK_EQUAL(ctr_process(aes_128_ctr_decryption(cipher, iv), byte_string(output)), input);
+}
+
+// F.5.1 cut short: the output is as long as the input and an empty message yields no keystream
+BOOST_AUTO_TEST_CASE(aes_128_ctr_partial_block) {
+    block::aes<128> cipher(ctr_key("2b7e151628aed2a6abf7158809cf4f3c"));
+    block::aes<128>::block_type iv = ctr_iv("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+
+    BOOST_CHECK_EQUAL(ctr_process(aes_128_ctr_encryption(cipher, iv), byte_string(std::string())), "");
+    BOOST_CHECK_EQUAL(ctr_process(aes_128_ctr_encryption(cipher, iv), byte_string(std::string("6bc1bee22e"))),
+                      "874d6191b6");
+    BOOST_CHECK_EQUAL(ctr_process(aes_128_ctr_encryption(cipher, iv),
+                                  byte_string(std::string("6bc1bee22e409f96e93d7e117393172aae2d8a57"))),
+                      "874d6191b620e3261bef6864990db6ce9806f66b");
+    BOOST_CHECK_EQUAL(ctr_process(aes_128_ctr_decryption(cipher, iv),
+                                  byte_string(std::string("874d6191b620e3261bef6864990db6ce9806f66b"))),
+                      "6bc1bee22e409f96e93d7e117393172aae2d8a57");
+}
+
+// Spans more than one pipelined keystream batch and carries across a 32-bit counter boundary
+BOOST_AUTO_TEST_CASE(aes_128_ctr_multiple_batches) {
+    byte_string input(176);
+    for (std::size_t i = 0; i != input.size(); ++i) {
+        input[i] = static_cast<byte_string::value_type>(i);
+    }
+
+    std::string output =
+        "d5127161b4f5820ca206aa93040b5008757e762fa1d4ceec746c5fad8e514a6b"
+        "9b75b1a7c1b5e1612bb7ac143086025398393b7c6e46d99aa5c1691d81878aa7"
+        "4a530944e1c8ab052fd2f9ad96603322c155e713d436090d69262973210be25c"
+        "c581e91b70176c614a877f3a812490246557e2c92d1ca3b682a494afea94cece"
+        "098e76f6a627703a1dd93737a959b51d5ce0c14a617dcccfeefd84506402ba1a"
+        "69a5409540432270c3415707995bd64d";
+
+    block::aes<128> cipher(ctr_key("000102030405060708090a0b0c0d0e0f"));
+    block::aes<128>::block_type iv = ctr_iv("000102030405060708090a0bfffffffe");
+
+    BOOST_CHECK_EQUAL(ctr_process(aes_128_ctr_encryption(cipher, iv), input), output);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(aes_cbc_test_suite)
+
+typedef modes::cbc<block::aes<128>, block::nop_padding> aes_128_cbc_mode;
+typedef aes_128_cbc_mode::bind<aes_128_cbc_mode::encryption_policy>::type aes_128_cbc_encryption;
+typedef aes_128_cbc_mode::bind<aes_128_cbc_mode::decryption_policy>::type aes_128_cbc_decryption;
+
+template<typename Mode>
+std::string cbc_process(const Mode &mode, const byte_string &input) {
+    block::accumulator_set<Mode> acc(mode);
+
+    {
+        typename block::aes<128>::stream_processor<Mode, block::accumulator_set<Mode>, 8>::type sp(acc);
+        sp(input.begin(), input.end());
+    }
+
+    return std::to_string(accumulators::extract::block<Mode>(acc));
+}
+
+block::aes<128>::block_type cbc_block(const std::string &hex) {
+    byte_string b(hex);
+    block::aes<128>::block_type block = {0};
+    std::copy(b.begin(), b.end(), block.begin());
+    return block;
+}
+
+// F.2.1, F.2.2
+BOOST_AUTO_TEST_CASE(aes_128_cbc) {
+    std::string input =
+        "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+        "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+    std::string output =
+        "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2"
+        "73bed6b8e3c1743b7116e69e222295163ff1caa1681fac09120eca307586e1a7";
+
+    block::aes<128> cipher(cbc_block("2b7e151628aed2a6abf7158809cf4f3c"));
+    block::aes<128>::block_type iv = cbc_block("000102030405060708090a0b0c0d0e0f");
+
+    BOOST_CHECK_EQUAL(cbc_process(aes_128_cbc_encryption(cipher, iv), byte_string(input)), output);
+    BOOST_CHECK_EQUAL(cbc_process(aes_128_cbc_decryption(cipher, iv), byte_string(output)), input);
+}
+
+// Bulk processing spanning several decryption batches, split across calls and decrypted in place
+BOOST_AUTO_TEST_CASE(aes_128_cbc_process_n) {
+    std::string output =
+        "92afbb77740b82710f37b131ac6b3ad9fd6c523e167c9ffbaf3e77c1399bf0d9b69cd6e889bc68a29bd17586b3958a3e9e30ae53"
+        "13a50e84d60afddf4826cac28864c042f81079dced42e3379dd8a16f89270ed299e297a4eb92b3b650258fab4f5ea34212507ed0"
+        "0e9b8524a0faf63bfc6cea75a7078e6daf662d44cd51f62115ad8deb1e96c1f68f4cbeea84c8c489395b186dc98d45e939b6d140"
+        "2b977b90c28c825066e193d4c7b7c8b301ecfc091d5f549bec4a7660017d8533fe229d5842737df7b763804a7b5bdd064f233bbd"
+        "8aae0142120082f1b88cc23779d3b1b936cb903bf9aac0167bf9e6d6111df5c758ebea1f6f2ff9591789a9e65f5e73c571f3efb4"
+        "ae94374677059a0460c43270c20a43a7380cec7a28a428db32b3f9db436a0a6397bc4df06c97f225bb739c94f1906626643a32c0"
+        "21b378c5db2d0027b0c3df7db1f3b9bdbf7ad72b1a80bb200eb5ecd3faf13e5ed6c745dcbc4ee929bc5d58082c3b12972abba23f"
+        "27e6b417fc62c12a13e4d595cc9d38114b0bbfbac3f4d7d4a08dcdfa429b5158f2ecb37d9ff02837f0983d419816aef201aa3ddc"
+        "ad6fbc43ad7d989dc9219f334afd569dbf54f666537ef72155f11813ec665c43e86d9e97a424893106bccce92e6d11188a46b53f"
+        "4fc462888509cd17e3ee3ee71329c263e12a60a648d2911111a39bb0b3dae18cf29e86d854d2f2dad01ebd838b8bd738ee91a160"
+        "996dffd220d163cdb14061e4464770a69d065a773cd8e343b081bdcecc92dde96e15bbc757ee332b6f76bba9029e6a10d823c6e2"
+        "cb99f1aece4a195f9f2351183277d1922ba7ef07";
+
+    std::vector<block::aes<128>::block_type> plaintext(37);
+    for (std::size_t i = 0; i != plaintext.size() * 16; ++i) {
+        plaintext[i / 16][i % 16] = static_cast<std::uint8_t>(i * 5 + 1);
+    }
+
+    block::aes<128> cipher(cbc_block("000102030405060708090a0b0c0d0e0f"));
+    block::aes<128>::block_type iv = cbc_block("f0e0d0c0b0a090807060504030201000");
+
+    std::vector<block::aes<128>::block_type> ciphertext(plaintext.size());
+    aes_128_cbc_encryption encryption(cipher, iv);
+    encryption.process_n(plaintext.data(), ciphertext.data(), ciphertext.size());
+
+    std::vector<std::uint8_t> bytes;
+    for (const block::aes<128>::block_type &block : ciphertext) {
+        bytes.insert(bytes.end(), block.begin(), block.end());
+    }
+    BOOST_CHECK(byte_string(bytes.begin(), bytes.end()) == byte_string(output));
+
+    aes_128_cbc_decryption decryption(cipher, iv);
+    decryption.process_n(ciphertext.data(), ciphertext.data(), 5);
+    decryption.process_n(ciphertext.data() + 5, ciphertext.data() + 5, ciphertext.size() - 5);
+    BOOST_CHECK(ciphertext == plaintext);
+}
+
+// Messages of different lengths, more than fit in the interleaved lanes, against separate encryptions
+BOOST_AUTO_TEST_CASE(aes_128_cbc_process_messages) {
+    block::aes<128> cipher(cbc_block("000102030405060708090a0b0c0d0e0f"));
+
+    typedef std::pair<block::aes<128>::block_type, std::vector<std::uint8_t>> message_type;
+    std::vector<message_type> messages;
+    for (std::size_t m = 0; m != 37; ++m) {
+        message_type message;
+        for (std::size_t i = 0; i != message.first.size(); ++i) {
+            message.first[i] = static_cast<std::uint8_t>(m * 16 + i);
+        }
+        message.second.resize(16 * ((m * 7) % 23));
+        for (std::size_t i = 0; i != message.second.size(); ++i) {
+            message.second[i] = static_cast<std::uint8_t>(m + i * 3);
+        }
+        messages.push_back(message);
+    }
+
+    std::vector<message_type> encrypted = messages;
+    aes_128_cbc_encryption(cipher).process_messages(encrypted.begin(), encrypted.end());
+
+    for (std::size_t m = 0; m != messages.size(); ++m) {
+        std::string expected = cbc_process(aes_128_cbc_encryption(cipher, messages[m].first),
+                                           byte_string(messages[m].second.begin(), messages[m].second.end()));
+        if (messages[m].second.empty()) {
+            BOOST_CHECK(encrypted[m].second.empty());
+        } else {
+            BOOST_CHECK(byte_string(encrypted[m].second.begin(), encrypted[m].second.end()) == byte_string(expected));
+        }
+    }
+
+    aes_128_cbc_decryption(cipher).process_messages(encrypted.begin(), encrypted.end());
+    BOOST_CHECK(encrypted == messages);
+}
+
+// A bad length anywhere in the batch is reported before any message is touched
+BOOST_AUTO_TEST_CASE(aes_128_cbc_process_messages_bad_length) {
+    block::aes<128> cipher(cbc_block("000102030405060708090a0b0c0d0e0f"));
+
+    typedef std::pair<block::aes<128>::block_type, std::vector<std::uint8_t>> message_type;
+    std::vector<message_type> messages(20);
+    for (std::size_t m = 0; m != messages.size(); ++m) {
+        messages[m].first.fill(static_cast<std::uint8_t>(m));
+        messages[m].second.assign(m == 17 ? 33 : 16 * (m % 5 + 1), static_cast<std::uint8_t>(m + 1));
+    }
+
+    std::vector<message_type> processed = messages;
+    BOOST_CHECK_THROW(aes_128_cbc_encryption(cipher).process_messages(processed.begin(), processed.end()),
+                      std::invalid_argument);
+    BOOST_CHECK(processed == messages);
+    BOOST_CHECK_THROW(aes_128_cbc_decryption(cipher).process_messages(processed.begin(), processed.end()),
+                      std::invalid_argument);
+    BOOST_CHECK(processed == messages);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(aes_gcm_test_suite)
+
+template<typename Cipher, typename Mode>
+std::string gcm_process(const Mode &mode, const byte_string &input) {
+    block::accumulator_set<Mode> acc(mode);
+
+    {
+        typename Cipher::template stream_processor<Mode, block::accumulator_set<Mode>, 8>::type sp(acc);
+        sp(input.begin(), input.end());
+    }
+
+    return std::to_string(accumulators::extract::block<Mode>(acc));
+}
+
+template<typename Cipher>
+Cipher gcm_cipher(const std::string &key) {
+    byte_string key_bytes(key);
+    typename Cipher::key_type cipher_key = {0};
+    std::copy(key_bytes.begin(), key_bytes.end(), cipher_key.begin());
+    return Cipher(cipher_key);
+}
+
+template<typename Cipher>
+std::string gcm_encrypt(const std::string &key, const std::string &iv, const std::string &aad,
+                        const byte_string &input) {
+    typedef modes::gcm<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+
+    encryption_mode mode(gcm_cipher<Cipher>(key), byte_string(iv), byte_string(aad));
+    return gcm_process<Cipher>(mode, input);
+}
+
+template<typename Cipher>
+std::string gcm_decrypt(const std::string &key, const std::string &iv, const std::string &aad,
+                        const byte_string &input, const std::string &tag) {
+    typedef modes::gcm<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::decryption_policy>::type decryption_mode;
+
+    decryption_mode mode(gcm_cipher<Cipher>(key), byte_string(iv), byte_string(aad), byte_string(tag));
+    return gcm_process<Cipher>(mode, input);
+}
+
+// McGrew, Viega. The Galois/Counter Mode of Operation, test cases 1-4, 6 and 16. The output is the
+// ciphertext followed by the tag, on decryption the plaintext once the received tag has been checked
+BOOST_AUTO_TEST_CASE(aes_128_gcm_empty) {
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes<128>>("00000000000000000000000000000000", "000000000000000000000000",
+                                                   "", byte_string(std::string())),
+                      "58e2fccefa7e3061367f1d57a4e7455a");
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes<128>>("00000000000000000000000000000000", "000000000000000000000000",
+                                                   "", byte_string(std::string("00000000000000000000000000000000"))),
+                      "0388dace60b6a392f328c2b971b2fe78ab6e47d42cec13bdf53a67b21257bddf");
+    BOOST_CHECK_EQUAL(gcm_decrypt<block::aes<128>>("00000000000000000000000000000000", "000000000000000000000000",
+                                                   "", byte_string(std::string()), "58e2fccefa7e3061367f1d57a4e7455a"),
+                      "");
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_gcm) {
+    std::string key = "feffe9928665731c6d6a8f9467308308";
+    std::string plaintext =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5"
+        "aa0de657ba637b391aafd255";
+    std::string ciphertext =
+        "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa051ba30b39"
+        "6a0aac973d58e091473f5985";
+
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes<128>>(key, "cafebabefacedbaddecaf888", "", byte_string(plaintext)),
+                      ciphertext + "4d5c2af327cd64a62cf35abd2ba6fab4");
+    BOOST_CHECK_EQUAL(gcm_decrypt<block::aes<128>>(key, "cafebabefacedbaddecaf888", "", byte_string(ciphertext),
+                                                   "4d5c2af327cd64a62cf35abd2ba6fab4"),
+                      plaintext);
+}
+
+// A forged tag or one that was never passed in releases no plaintext
+BOOST_AUTO_TEST_CASE(aes_128_gcm_forged) {
+    typedef modes::gcm<block::aes<128>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    std::string key = "feffe9928665731c6d6a8f9467308308";
+    std::string ciphertext =
+        "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa051ba30b39"
+        "6a0aac973d58e091473f5985";
+
+    BOOST_CHECK_THROW(gcm_decrypt<block::aes<128>>(key, "cafebabefacedbaddecaf888", "", byte_string(ciphertext),
+                                                   "4d5c2af327cd64a62cf35abd2ba6fab5"),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(gcm_decrypt<block::aes<128>>(key, "cafebabefacedbaddecaf888", "feed", byte_string(ciphertext),
+                                                   "4d5c2af327cd64a62cf35abd2ba6fab4"),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(gcm_decrypt<block::aes<128>>(key, "cafebabefacedbaddecaf888", "", byte_string(ciphertext),
+                                                   "4d5c2af327cd64a62cf35abd2ba6fa"),
+                      std::invalid_argument);
+
+    decryption_mode mode(gcm_cipher<block::aes<128>>(key), byte_string(std::string("cafebabefacedbaddecaf888")));
+    BOOST_CHECK_THROW(gcm_process<block::aes<128>>(mode, byte_string(ciphertext)), std::invalid_argument);
+}
+
+// A decryption long enough to be streamed is still buffered until the tag has been checked
+BOOST_AUTO_TEST_CASE(aes_128_gcm_forged_long) {
+    typedef modes::gcm<block::aes<128>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+    typedef block::detail::value_cipher_impl<block::accumulator_set<decryption_mode>> decrypter_state;
+    typedef std::back_insert_iterator<std::vector<std::uint8_t>> output_iterator;
+    typedef block::detail::itr_cipher_impl<decrypter_state, output_iterator> decrypter;
+
+    std::string key = "000102030405060708090a0b0c0d0e0f";
+    byte_string iv(std::string("101112131415161718191a1b"));
+
+    byte_string plaintext(16 * 300 + 5);
+    for (std::size_t i = 0; i != plaintext.size(); ++i) {
+        plaintext[i] = static_cast<byte_string::value_type>(i * 7);
+    }
+
+    byte_string sealed(gcm_process<block::aes<128>>(encryption_mode(gcm_cipher<block::aes<128>>(key), iv),
+                                                    plaintext));
+    std::vector<std::uint8_t> ciphertext(sealed.begin(), sealed.end() - 16);
+    std::vector<std::uint8_t> tag(sealed.end() - 16, sealed.end());
+
+    std::vector<std::uint8_t> out;
+    output_iterator it =
+        decrypter(ciphertext, std::back_inserter(out),
+                  decryption_mode(gcm_cipher<block::aes<128>>(key), iv, std::vector<std::uint8_t>(), tag));
+    BOOST_CHECK(out.size() == plaintext.size());
+    BOOST_CHECK(std::equal(out.begin(), out.end(), plaintext.begin()));
+
+    tag[0] ^= 1;
+    out.clear();
+    BOOST_CHECK_THROW(
+        it = decrypter(ciphertext, std::back_inserter(out),
+                       decryption_mode(gcm_cipher<block::aes<128>>(key), iv, std::vector<std::uint8_t>(), tag)),
+        std::invalid_argument);
+    BOOST_CHECK(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_gcm_partial_block_with_aad) {
+    std::string key = "feffe9928665731c6d6a8f9467308308";
+    std::string aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+    std::string plaintext =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5"
+        "aa0de657ba637b39";
+
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes<128>>(key, "cafebabefacedbaddecaf888", aad, byte_string(plaintext)),
+                      "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa05"
+                      "1ba30b396a0aac973d58e0915bc94fbc3221a5db94fae95ae7121a47");
+
+    // 60-byte IV, hashed into the initial counter
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes<128>>(key,
+                                                   "9313225df88406e555909c5aff5269aa6a7a9538534f7da1e4c303d2a318a728c3"
+                                                   "c0c95156809539fcf0e2429a6b525416aedbf5a0de6a57a637b39b",
+                                                   aad, byte_string(plaintext)),
+                      "8ce24998625615b603a033aca13fb894be9112a5c3a211a8ba262a3cca7e2ca701e4a9a4fba43c90ccdcb281d48c7c6f"
+                      "d62875d2aca417034c34aee5619cc5aefffe0bfa462af43c1699d050");
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_gcm) {
+    std::string plaintext =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5"
+        "aa0de657ba637b39";
+
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes<256>>("feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308",
+                                                   "cafebabefacedbaddecaf888",
+                                                   "feedfacedeadbeeffeedfacedeadbeefabaddad2", byte_string(plaintext)),
+                      "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa8cb08e48590dbb3da7b08b1056828838"
+                      "c5f61e6393ba7a0abcc9f66276fc6ece0f4e1768cddf8853bb2d551b");
+}
+
+// Spans several keystream batches and aggregated GHASH updates and ends in a partial block
+BOOST_AUTO_TEST_CASE(aes_128_gcm_long) {
+    byte_string input(301);
+    for (std::size_t i = 0; i != input.size(); ++i) {
+        input[i] = static_cast<byte_string::value_type>(i);
+    }
+
+    std::string output =
+        "c42f01ac0b4ab0e81fd457fecb2ae5312aad669422e17da89dd2330a7b180fb2f2f8031ca583dd3bcb89ffe3f6fd7f34b989c318"
+        "cdf68ddf532c178dbbad78a71e1950e766d23bdc86c9300be1ece26e26d3e6dd2d96f8870521c9bcac8da329f141a2fbc5aadbae"
+        "7900ffd48f126df42cba0c978ae3fe99c1e4db18f32101debc346060ae6e3f8542d1088e88d2ee985059badbd920869eca606074"
+        "982c8121c621008366781f05d832745dfde81124afe8b7615c8aaa32f08f5b1b34b990c17a68581eb128ea5d5379bd7a6bad8e20"
+        "71d377c160b20adeb159e1bd39f70dc8260ad84f4d2381f9004f48458156ad923bfb5229ac01c024fb385157b996d0e28d395f45"
+        "4d93bf03b14a17a795f53499daf5b49f1d7e0d29fb3bb73af5d3212b10a60f60012bea153e4796a68e";
+    std::string tag = "223d76bd539afaa73c8ccf886efbc372";
+
+    std::string key = "000102030405060708090a0b0c0d0e0f", iv = "101112131415161718191a1b",
+                aad = "000102030405060708090a0b0c0d0e0f10111213";
+
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes<128>>(key, iv, aad, input), output + tag);
+    BOOST_CHECK(byte_string(gcm_decrypt<block::aes<128>>(key, iv, aad, byte_string(output), tag)) == input);
+}
+
+// GCM never runs the inverse cipher, so the encryption-only AES drives both directions
+BOOST_AUTO_TEST_CASE(aes_128_gcm_encryption_only) {
+    std::string key = "feffe9928665731c6d6a8f9467308308";
+    std::string plaintext =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5"
+        "aa0de657ba637b391aafd255";
+    std::string ciphertext =
+        "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa051ba30b39"
+        "6a0aac973d58e091473f5985";
+
+    BOOST_CHECK_EQUAL(gcm_encrypt<block::aes_encryption<128>>(key, "cafebabefacedbaddecaf888", "",
+                                                              byte_string(plaintext)),
+                      ciphertext + "4d5c2af327cd64a62cf35abd2ba6fab4");
+    BOOST_CHECK_EQUAL(gcm_decrypt<block::aes_encryption<128>>(key, "cafebabefacedbaddecaf888", "",
+                                                              byte_string(ciphertext),
+                                                              "4d5c2af327cd64a62cf35abd2ba6fab4"),
+                      plaintext);
+}
+
+// Test case 2 GHASH, then both implementations against each other over a length that is not a
+// multiple of the aggregation width
+BOOST_AUTO_TEST_CASE(ghash_implementations) {
+    typedef block::detail::ghash_impl::block_type ghash_block_type;
+
+    const ghash_block_type h = {0x66, 0xe9, 0x4b, 0xd4, 0xef, 0x8a, 0x2c, 0x3b,
+                                0x88, 0x4c, 0xfa, 0x59, 0xca, 0x34, 0x2b, 0x2e};
+    const std::uint8_t message[32] = {0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2,
+                                      0xb9, 0x71, 0xb2, 0xfe, 0x78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80};
+    const ghash_block_type expected = {0xf3, 0x8c, 0xbb, 0x1a, 0xd6, 0x92, 0x23, 0xdc,
+                                       0xc3, 0x45, 0x7a, 0xe5, 0xb6, 0xb0, 0xf8, 0x85};
+
+    std::vector<std::uint8_t> long_message(16 * 37);
+    for (std::size_t i = 0; i != long_message.size(); ++i) {
+        long_message[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+
+    block::detail::ghash_impl::key_type table_key;
+    block::detail::ghash_impl::schedule_key(table_key, h);
+
+    ghash_block_type x = {0};
+    block::detail::ghash_impl::update(x, table_key, message, 2);
+    BOOST_CHECK(x == expected);
+
+    ghash_block_type table_long = {0};
+    block::detail::ghash_impl::update(table_long, table_key, long_message.data(), 37);
+
+#if BOOST_ARCH_X86
+    if (cpuid::has_clmul() && cpuid::has_ssse3()) {
+        block::detail::ghash_clmul_impl::key_type clmul_key;
+        block::detail::ghash_clmul_impl::schedule_key(clmul_key, h);
+
+        ghash_block_type y = {0};
+        block::detail::ghash_clmul_impl::update(y, clmul_key, message, 2);
+        BOOST_CHECK(y == expected);
+
+        ghash_block_type clmul_long = {0};
+        block::detail::ghash_clmul_impl::update(clmul_long, clmul_key, long_message.data(), 37);
+        BOOST_CHECK(clmul_long == table_long);
+    } else {
+        BOOST_TEST_MESSAGE("PCLMULQDQ is not available, skipping");
+    }
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(aes_gcm_siv_test_suite)
+
+std::vector<std::uint8_t> gcm_siv_message(std::size_t bytes) {
+    std::vector<std::uint8_t> message(bytes);
+    for (std::size_t i = 0; i != message.size(); ++i) {
+        message[i] = static_cast<std::uint8_t>(i * 13 + 1);
+    }
+    return message;
+}
+
+template<typename Cipher>
+Cipher gcm_siv_cipher() {
+    typename Cipher::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i);
+    }
+    return Cipher(key);
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_gcm_siv) {
+    typedef modes::gcm_siv<block::aes<128>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    // RFC 8452, Appendix C.1
+    block::aes<128> cipher({0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+    encryption_mode encryption(cipher);
+    decryption_mode decryption(cipher);
+
+    const encryption_mode::nonce_type nonce = {0x03};
+    encryption_mode::tag_type tag;
+
+    std::vector<std::uint8_t> message;
+    BOOST_CHECK(encryption.process_message(nonce, nullptr, 0, message.data(), 0, tag));
+    BOOST_CHECK(byte_string(tag.begin(), tag.end()) ==
+                byte_string(std::string("dc20e2d83f25705bb49e439eca56de25")));
+
+    message = {0x01, 0, 0, 0, 0, 0, 0, 0};
+    BOOST_CHECK(encryption.process_message(nonce, nullptr, 0, message.data(), message.size(), tag));
+    BOOST_CHECK(byte_string(message.begin(), message.end()) == byte_string(std::string("b5d839330ac7b786")));
+    BOOST_CHECK(byte_string(tag.begin(), tag.end()) ==
+                byte_string(std::string("578782fff6013b815b287c22493a364c")));
+
+    BOOST_CHECK(decryption.process_message(nonce, nullptr, 0, message.data(), message.size(), tag));
+    BOOST_CHECK(message == std::vector<std::uint8_t>({0x01, 0, 0, 0, 0, 0, 0, 0}));
+
+    BOOST_CHECK(encryption.process_message(nonce, nullptr, 0, message.data(), message.size(), tag));
+    tag[0] ^= 1;
+    BOOST_CHECK(!decryption.process_message(nonce, nullptr, 0, message.data(), message.size(), tag));
+    BOOST_CHECK(message == std::vector<std::uint8_t>(8, 0));
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_gcm_siv_messages) {
+    typedef modes::gcm_siv<block::aes<256>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    const block::aes<256> cipher = gcm_siv_cipher<block::aes<256>>();
+    const encryption_mode::nonce_type nonce = {0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04};
+    std::vector<std::uint8_t> aad(17);
+    for (std::size_t i = 0; i != aad.size(); ++i) {
+        aad[i] = static_cast<std::uint8_t>(i + 1);
+    }
+
+    // the same message twice under the same nonce, with another nonce in between
+    std::vector<encryption_mode::message_type> messages = {{nonce, aad, gcm_siv_message(1100), {}},
+                                                           {{0x03}, {}, {}, {}},
+                                                           {nonce, aad, gcm_siv_message(1100), {}}};
+
+    encryption_mode encryption(cipher);
+    BOOST_CHECK_EQUAL(encryption.process_messages(messages.begin(), messages.end()), 0);
+
+    BOOST_CHECK(byte_string(messages[0].data.begin(), messages[0].data.begin() + 32) ==
+                byte_string(std::string("3845cd6fafd55cedc0d42f74d68aaf5fbef73ec6e7d2882115d46f4269f4ae8c")));
+    BOOST_CHECK(byte_string(messages[0].data.end() - 32, messages[0].data.end()) ==
+                byte_string(std::string("432db2b206f7cccebddc9b3822d263079d5d3fc82022fd4346f9011d0d63ad88")));
+    BOOST_CHECK(byte_string(messages[0].tag.begin(), messages[0].tag.end()) ==
+                byte_string(std::string("09e2fde4b75b3aa27095e14b9a5cf2af")));
+    BOOST_CHECK(messages[2].data == messages[0].data);
+    BOOST_CHECK(messages[2].tag == messages[0].tag);
+
+    // RFC 8452, Appendix C.2
+    block::aes<256> rfc_cipher({0x01});
+    encryption_mode::tag_type tag;
+    encryption_mode(rfc_cipher).process_message({0x03}, nullptr, 0, nullptr, 0, tag);
+    BOOST_CHECK(byte_string(tag.begin(), tag.end()) ==
+                byte_string(std::string("07f5f4169bbf55a8400cd47ea6fd400f")));
+
+    decryption_mode decryption(cipher);
+    messages[1].tag[15] ^= 0x80;
+    BOOST_CHECK_EQUAL(decryption.process_messages(messages.begin(), messages.end()), 1);
+    BOOST_CHECK(messages[0].data == gcm_siv_message(1100));
+    BOOST_CHECK(messages[2].data == gcm_siv_message(1100));
+}
+
+BOOST_AUTO_TEST_CASE(polyval_implementations) {
+    typedef block::detail::polyval_impl::block_type polyval_block_type;
+
+    // RFC 8452, Appendix A
+    const polyval_block_type h = {0x25, 0x62, 0x93, 0x47, 0x58, 0x92, 0x42, 0x76,
+                                  0x1d, 0x31, 0xf8, 0x26, 0xba, 0x4b, 0x75, 0x7b};
+    const std::uint8_t message[32] = {0x4f, 0x4f, 0x95, 0x66, 0x8c, 0x83, 0xdf, 0xb6, 0x40, 0x17, 0x62,
+                                      0xbb, 0x2d, 0x01, 0xa2, 0x62, 0xd1, 0xa2, 0x4d, 0xdd, 0x27, 0x21,
+                                      0xd0, 0x06, 0xbb, 0xe4, 0x5f, 0x20, 0xd3, 0xc9, 0xf3, 0x62};
+    const polyval_block_type expected = {0xf7, 0xa3, 0xb4, 0x7b, 0x84, 0x61, 0x19, 0xfa,
+                                         0xe5, 0xb7, 0x86, 0x6c, 0xf5, 0xe5, 0xb7, 0x7e};
+
+    const std::vector<std::uint8_t> long_message = gcm_siv_message(16 * 37);
+
+    block::detail::polyval_impl::key_type table_key;
+    block::detail::polyval_impl::schedule_key(table_key, h);
+
+    polyval_block_type x = {0};
+    block::detail::polyval_impl::update(x, table_key, message, 2);
+    BOOST_CHECK(x == expected);
+
+    polyval_block_type table_long = {0};
+    block::detail::polyval_impl::update(table_long, table_key, long_message.data(), 37);
+
+#if BOOST_ARCH_X86
+    if (cpuid::has_clmul() && cpuid::has_ssse3()) {
+        block::detail::polyval_clmul_impl::key_type clmul_key;
+        block::detail::polyval_clmul_impl::schedule_key(clmul_key, h);
+
+        polyval_block_type y = {0};
+        block::detail::polyval_clmul_impl::update(y, clmul_key, message, 2);
+        BOOST_CHECK(y == expected);
+
+        polyval_block_type clmul_long = {0};
+        block::detail::polyval_clmul_impl::update(clmul_long, clmul_key, long_message.data(), 37);
+        BOOST_CHECK(clmul_long == table_long);
+    } else {
+        BOOST_TEST_MESSAGE("PCLMULQDQ is not available, skipping");
+    }
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(aes_ccm_test_suite)
+
+std::vector<std::uint8_t> ccm_bytes(std::size_t bytes, std::size_t multiplier, std::size_t offset) {
+    std::vector<std::uint8_t> result(bytes);
+    for (std::size_t i = 0; i != result.size(); ++i) {
+        result[i] = static_cast<std::uint8_t>(i * multiplier + offset);
+    }
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_ccm) {
+    typedef modes::ccm<block::aes<128>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    // RFC 3610, packet vector #1
+    block::aes<128> cipher({0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                            0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf});
+    const std::vector<std::uint8_t> nonce = {0, 0, 0, 0x03, 0x02, 0x01, 0, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+    const std::vector<std::uint8_t> aad = ccm_bytes(8, 1, 0), plaintext = ccm_bytes(23, 1, 8);
+
+    encryption_mode encryption(cipher, 8);
+    decryption_mode decryption(cipher, 8);
+
+    std::vector<std::uint8_t> message = plaintext, tag(encryption.tag_size());
+    BOOST_CHECK(encryption.process_message(nonce, aad.data(), aad.size(), message.data(), message.size(), tag.data()));
+    BOOST_CHECK(byte_string(message.begin(), message.end()) ==
+                byte_string(std::string("588c979a61c663d2f066d0c2c0f989806d5f6b61dac384")));
+    BOOST_CHECK(byte_string(tag.begin(), tag.end()) == byte_string(std::string("17e8d12cfdf926e0")));
+
+    BOOST_CHECK(decryption.process_message(nonce, aad.data(), aad.size(), message.data(), message.size(), tag.data()));
+    BOOST_CHECK(message == plaintext);
+
+    BOOST_CHECK(encryption.process_message(nonce, aad.data(), aad.size(), message.data(), message.size(), tag.data()));
+    message[22] ^= 1;
+    BOOST_CHECK(!decryption.process_message(nonce, aad.data(), aad.size(), message.data(), message.size(), tag.data()));
+    BOOST_CHECK(message == std::vector<std::uint8_t>(23, 0));
+
+    // CCM-4 without associated data, 7-byte nonce
+    const std::vector<std::uint8_t> short_nonce = ccm_bytes(7, 1, 0x10);
+    block::aes<128> cipher_128(
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f});
+    message = ccm_bytes(37, 17, 9);
+    tag.resize(4);
+    BOOST_CHECK(encryption_mode(cipher_128, 4).process_message(short_nonce, nullptr, 0, message.data(),
+                                                               message.size(), tag.data()));
+    BOOST_CHECK(byte_string(message.begin(), message.end()) ==
+                byte_string(std::string("a374166ed8b79ec777a1440ac808024862924e4ae2572db1d1fd803baf875cf4e756113ca7")));
+    BOOST_CHECK(byte_string(tag.begin(), tag.end()) == byte_string(std::string("f1aee794")));
+
+    BOOST_CHECK_THROW(encryption_mode(cipher, 5), std::invalid_argument);
+    BOOST_CHECK_THROW(encryption.process_message(ccm_bytes(6, 1, 0), nullptr, 0, message.data(), message.size(),
+                                                 tag.data()),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_ccm_long_aad) {
+    typedef modes::ccm<block::aes<256>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    block::aes<256>::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i);
+    }
+    block::aes<256> cipher(key);
+
+    // associated data this long takes the six-byte length encoding
+    const std::vector<std::uint8_t> nonce = ccm_bytes(12, 1, 0x10), aad = ccm_bytes(65300, 5, 2);
+    std::vector<std::uint8_t> message = ccm_bytes(1000, 17, 9), tag(16);
+
+    encryption_mode(cipher).process_message(nonce, aad.data(), aad.size(), message.data(), message.size(),
+                                            tag.data());
+    BOOST_CHECK(byte_string(message.begin(), message.begin() + 32) ==
+                byte_string(std::string("78aada3f2b150fe0fd512eaae9b947392fde9c61b86a4a99d8e7f5acc53c6814")));
+    BOOST_CHECK(byte_string(message.end() - 32, message.end()) ==
+                byte_string(std::string("561cc91f81473553058da7b0c1f3fef757118eacfaeeebb0b0dbbe9162ce0c3c")));
+    BOOST_CHECK(byte_string(tag.begin(), tag.end()) == byte_string(std::string("2e55121751da6c4e300c75efdc4a6b8a")));
+
+    BOOST_CHECK(decryption_mode(cipher).process_message(nonce, aad.data(), aad.size(), message.data(),
+                                                        message.size(), tag.data()));
+    BOOST_CHECK(message == ccm_bytes(1000, 17, 9));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(aes_ocb_test_suite)
+
+template<typename Cipher, typename Mode>
+std::string ocb_process(const Mode &mode, const byte_string &input) {
+    block::accumulator_set<Mode> acc(mode);
+
+    {
+        typename Cipher::template stream_processor<Mode, block::accumulator_set<Mode>, 8>::type sp(acc);
+        sp(input.begin(), input.end());
+    }
+
+    return std::to_string(accumulators::extract::block<Mode>(acc));
+}
+
+template<typename Cipher>
+Cipher ocb_cipher(const std::string &key) {
+    byte_string key_bytes(key);
+    typename Cipher::key_type cipher_key = {0};
+    std::copy(key_bytes.begin(), key_bytes.end(), cipher_key.begin());
+    return Cipher(cipher_key);
+}
+
+template<typename Cipher>
+std::string ocb_encrypt(const std::string &key, const std::string &nonce, const std::string &aad,
+                        const byte_string &input) {
+    typedef modes::ocb<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::encryption_policy>::type encryption_mode;
+
+    encryption_mode mode(ocb_cipher<Cipher>(key), byte_string(nonce), byte_string(aad));
+    return ocb_process<Cipher>(mode, input);
+}
+
+template<typename Cipher>
+std::string ocb_decrypt(const std::string &key, const std::string &nonce, const std::string &aad,
+                        const byte_string &input, const std::string &tag) {
+    typedef modes::ocb<Cipher, block::nop_padding> mode_type;
+    typedef typename mode_type::template bind<typename mode_type::decryption_policy>::type decryption_mode;
+
+    decryption_mode mode(ocb_cipher<Cipher>(key), byte_string(nonce), byte_string(aad), byte_string(tag));
+    return ocb_process<Cipher>(mode, input);
+}
+
+std::vector<std::uint8_t> ocb_message(std::size_t bytes) {
+    std::vector<std::uint8_t> message(bytes);
+    for (std::size_t i = 0; i != message.size(); ++i) {
+        message[i] = static_cast<std::uint8_t>(i * 11 + 5);
+    }
+    return message;
+}
+
+// RFC 7253 appendix A
+BOOST_AUTO_TEST_CASE(aes_128_ocb) {
+    std::string key = "000102030405060708090a0b0c0d0e0f";
+
+    BOOST_CHECK_EQUAL(ocb_encrypt<block::aes<128>>(key, "bbaa99887766554433221100", "", byte_string(std::string())),
+                      "785407bfffc8ad9edcc5520ac9111ee6");
+    BOOST_CHECK_EQUAL(ocb_encrypt<block::aes<128>>(key, "bbaa99887766554433221101", "0001020304050607",
+                                                   byte_string(std::string("0001020304050607"))),
+                      "6820b3657b6f615a5725bda0d3b4eb3a257c9af1f8f03009");
+
+    std::string text = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f2021222324252627";
+    std::string ciphertext = "d5ca91748410c1751ff8a2f618255b68a0a12e093ff454606e59f9c1d0ddc54b65e8628e568bad7a";
+    std::string tag = "ed07ba06a4a69483a7035490c5769e60";
+
+    BOOST_CHECK_EQUAL(ocb_encrypt<block::aes<128>>(key, "bbaa9988776655443322110d", text, byte_string(text)),
+                      ciphertext + tag);
+    BOOST_CHECK_EQUAL(
+        ocb_decrypt<block::aes<128>>(key, "bbaa9988776655443322110d", text, byte_string(ciphertext), tag), text);
+}
+
+// A forged tag or one that was never passed in releases no plaintext
+BOOST_AUTO_TEST_CASE(aes_128_ocb_forged) {
+    typedef modes::ocb<block::aes<128>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    std::string key = "000102030405060708090a0b0c0d0e0f";
+    std::string text = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f2021222324252627";
+    std::string ciphertext = "d5ca91748410c1751ff8a2f618255b68a0a12e093ff454606e59f9c1d0ddc54b65e8628e568bad7a";
+
+    BOOST_CHECK_THROW(ocb_decrypt<block::aes<128>>(key, "bbaa9988776655443322110d", text, byte_string(ciphertext),
+                                                   "ed07ba06a4a69483a7035490c5769e61"),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(ocb_decrypt<block::aes<128>>(key, "bbaa9988776655443322110d", "", byte_string(ciphertext),
+                                                   "ed07ba06a4a69483a7035490c5769e60"),
+                      std::invalid_argument);
+
+    decryption_mode mode(ocb_cipher<block::aes<128>>(key), byte_string(std::string("bbaa9988776655443322110d")),
+                         byte_string(text));
+    BOOST_CHECK_THROW(ocb_process<block::aes<128>>(mode, byte_string(ciphertext)), std::invalid_argument);
+}
+
+// Spans several cipher batches and ends in a partial block
+BOOST_AUTO_TEST_CASE(aes_128_ocb_long) {
+    std::string key = "000102030405060708090a0b0c0d0e0f", nonce = "bbaa99887766554433221107",
+                aad = "000102030405060708090a0b0c0d0e0f1011121314151617";
+    std::vector<std::uint8_t> message = ocb_message(301);
+    std::string ciphertext =
+        "4ed05e124329278ffd214d33b50bdd34a19a4ec28d2b84091c0d5e15b8871120c08f5a40240b6b1faf887b0265a10acf740c10c2"
+        "f4de71c3ec1631133d3627829f05967212a555f7daf671ddc5401da61e7f0b4132042d3f375721f19edcfff1c049e0c88c10a2f8"
+        "2124c457b8abe59c9f211245d31c83b2d5d63a6d751b17d52391b0f4e2c587b955fb88d19c1ade092b2838d44619c83a38c15bc3"
+        "2d13154d55bb57f101f552dcfd41390f6afff1e96ecd2fe12c5531ead17b3f3bd9a703ca67b75aec2533fa7a98d1acba7dc822e8"
+        "d92b66d2f949895c482ff8d8a28c01bd306355ffc2b230e4a246f752776c58f7317442c002ad7cb5292291d244cd2965f7e074c5"
+        "dd580a9e602af9d6457f12448f0f661c049b875a8e9ff36892658b2c45f35d931a99bd0880f17240ab";
+    std::string tag = "5a5c830ae1ad2f518df7267aae3cc5dc";
+
+    BOOST_CHECK_EQUAL(ocb_encrypt<block::aes<128>>(key, nonce, aad, byte_string(message.begin(), message.end())),
+                      ciphertext + tag);
+    BOOST_CHECK(byte_string(ocb_decrypt<block::aes<128>>(key, nonce, aad, byte_string(ciphertext), tag)) ==
+                byte_string(message.begin(), message.end()));
+}
+
+// Whole blocks through process_n, the last one finished with end_message and finish_message
+BOOST_AUTO_TEST_CASE(aes_256_ocb_process_n) {
+    typedef modes::ocb<block::aes<256>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+
+    block::aes<256>::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i);
+    }
+    block::aes<256> cipher(key);
+
+    std::vector<std::uint8_t> message = ocb_message(256);
+    std::vector<block::aes<256>::block_type> blocks(16);
+    for (std::size_t i = 0; i != message.size(); ++i) {
+        blocks[i / 16][i % 16] = message[i];
+    }
+
+    encryption_mode mode(cipher, byte_string(std::string("0102030405060708090a0b0c0d0e")),
+                         byte_string(std::string("0001020304")));
+    mode.process_n(blocks.data(), blocks.data(), 15);
+    const block::aes<256>::block_type last = blocks[15];
+    blocks[15] = mode.end_message(last, message.size() * 8);
+
+    std::vector<std::uint8_t> ciphertext;
+    for (const block::aes<256>::block_type &block : blocks) {
+        ciphertext.insert(ciphertext.end(), block.begin(), block.end());
+    }
+    BOOST_CHECK(mode.finish_message(last, message.size() * 8, ciphertext));
+    BOOST_CHECK(byte_string(ciphertext.begin(), ciphertext.end()) ==
+                byte_string(std::string(
+            "52355917c5e9a47b593c005bff135fc9de491665502c2b07cebdcb9de7ffb3a534f1f9584e9b06eff3ad4f7ed08aad26a9ed"
+            "e32bd969fa5ab7f7ac83341d02a3d2c470f88ed4f4f1fe880ba7189b20bd2f11f174ef91fb040a1ca251569346d1fb9d45fe"
+            "a2b294745926bfebc28e0179ec5078eb56c05f14731208c2810789f41b88115c1adf29df5a2c3ed9beb01a0c5a17ae9720af"
+            "c58791a7b8b87460d21f570a93221575dc756a1d89b1d7bb7e4e867c80c0886e7b9122488545ed0fcb817a3568cbc317140c"
+            "169724b852111504488cbfd3cb24d7f914ad56802106e4df936a2715e6641c81a9561c03a300d345f70537ed00d5c808c19f"
+            "66575311ebfcc7af192a74c2ecd0bf23d06c20e88238")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(aes_xts_test_suite)
+
+template<typename Cipher>
+Cipher xts_cipher(std::size_t first) {
+    typename Cipher::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(first + i);
+    }
+    return Cipher(key);
+}
+
+template<typename Cipher, typename Mode>
+std::string xts_process(const Mode &mode, const byte_string &input) {
+    block::accumulator_set<Mode> acc(mode);
+
+    {
+        typename Cipher::template stream_processor<Mode, block::accumulator_set<Mode>, 8>::type sp(acc);
+        sp(input.begin(), input.end());
+    }
+
+    return std::to_string(accumulators::extract::block<Mode>(acc));
+}
+
+std::vector<std::uint8_t> xts_sector(std::size_t bytes) {
+    std::vector<std::uint8_t> sector(bytes);
+    for (std::size_t i = 0; i != sector.size(); ++i) {
+        sector[i] = static_cast<std::uint8_t>(i * 7 + 3);
+    }
+    return sector;
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_xts) {
+    typedef modes::xts<block::aes<128>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    std::string ciphertext =
+        "56846a43888ae0db93b956313bb5b10f9dbbc60b04e078b5636a175d405e3ebebe687bfb4522069f5cfe44ca9592f1721b354e4c"
+        "f672764a1858334a72147d22";
+
+    block::aes<128> cipher = xts_cipher<block::aes<128>>(0), tweak_cipher = xts_cipher<block::aes<128>>(16);
+    std::vector<std::uint8_t> sector = xts_sector(64);
+
+    encryption_mode encryption(cipher, tweak_cipher, 0x123456789a);
+    BOOST_CHECK_EQUAL(xts_process<block::aes<128>>(encryption, byte_string(sector.begin(), sector.end())),
+                      ciphertext);
+
+    decryption_mode decryption(cipher, tweak_cipher, 0x123456789a);
+    BOOST_CHECK(byte_string(xts_process<block::aes<128>>(decryption, byte_string(ciphertext))) ==
+                byte_string(sector.begin(), sector.end()));
+
+    encryption.process_sector(0x123456789a, sector.data(), sector.size());
+    BOOST_CHECK(byte_string(sector.begin(), sector.end()) == byte_string(ciphertext));
+
+    BOOST_CHECK_THROW(encryption.process_sector(0, sector.data(), 40), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_xts_sectors) {
+    typedef modes::xts<block::aes<256>, block::nop_padding> mode_type;
+    typedef mode_type::bind<mode_type::encryption_policy>::type encryption_mode;
+    typedef mode_type::bind<mode_type::decryption_policy>::type decryption_mode;
+
+    block::aes<256> cipher = xts_cipher<block::aes<256>>(0), tweak_cipher = xts_cipher<block::aes<256>>(32);
+
+    std::vector<std::pair<std::uint64_t, std::vector<std::uint8_t>>> sectors = {{7, xts_sector(4096)},
+                                                                                {8, xts_sector(4096)}};
+
+    encryption_mode(cipher, tweak_cipher).process_sectors(sectors.begin(), sectors.end());
+
+    BOOST_CHECK(byte_string(sectors[0].second.begin(), sectors[0].second.begin() + 32) ==
+                byte_string(std::string("2a6921cf7bba2c099fe4eaa28d02a1ee4ecd1408db873d2458bd269f9df2984f")));
+    BOOST_CHECK(byte_string(sectors[0].second.end() - 32, sectors[0].second.end()) ==
+                byte_string(std::string("4c9c56c3d320718004dc3b456aec63893a97ae9dde6bdaf9a240547734be726d")));
+    BOOST_CHECK(byte_string(sectors[1].second.begin(), sectors[1].second.begin() + 32) ==
+                byte_string(std::string("d1544a0e1bdc2de0e6d883fd8000f32cf0a7117a9e8bdc55ccfd182dc5a48f68")));
+    BOOST_CHECK(byte_string(sectors[1].second.end() - 32, sectors[1].second.end()) ==
+                byte_string(std::string("4b608b8f502007109f9aad7ff90b3d6bbdba135b3dde94cb738c07c52141ff4d")));
+
+    decryption_mode(cipher, tweak_cipher).process_sectors(sectors.begin(), sectors.end());
+    BOOST_CHECK(sectors[0].second == xts_sector(4096));
+    BOOST_CHECK(sectors[1].second == xts_sector(4096));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#if defined(CRYPTO3_HAS_RIJNDAEL_RUNTIME_DISPATCH)
+
+BOOST_AUTO_TEST_SUITE(rijndael_wide_kernel_test_suite)
+
+// Runs every runtime-selectable x86 kernel the host supports on FIPS-197 appendix C and on batch
+// lengths covering the wide, single-vector and AES-NI tail loops
+template<typename Impl, std::size_t KeyBits>
+void check_kernel(const std::array<std::uint8_t, 16> &expected) {
+    typedef block::detail::rijndael_policy<KeyBits, 128> policy_type;
+    typedef typename policy_type::block_type block_type;
+
+    typename policy_type::key_type key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i);
+    }
+
+    typename policy_type::key_schedule_type encryption_key = {0}, decryption_key = {0};
+    Impl::schedule_key(key, encryption_key, decryption_key);
+
+    typename policy_type::key_schedule_type encryption_only = {0};
+    Impl::schedule_encryption_key(key, encryption_only);
+    BOOST_CHECK(encryption_only == encryption_key);
+
+    // Batched expansion covers full interleave groups and the per-key tail
+    std::vector<typename policy_type::key_type> keys(11, key);
+    for (std::size_t k = 0; k != keys.size(); ++k) {
+        keys[k][k % key.size()] ^= static_cast<std::uint8_t>(k + 1);
+    }
+    std::vector<typename policy_type::key_schedule_type> encryption_keys(keys.size()), decryption_keys(keys.size()),
+        encryption_only_keys(keys.size());
+    Impl::schedule_keys(keys.data(), keys.size(), encryption_keys.data(), decryption_keys.data());
+    Impl::schedule_encryption_keys(keys.data(), keys.size(), encryption_only_keys.data());
+    for (std::size_t k = 0; k != keys.size(); ++k) {
+        typename policy_type::key_schedule_type ek = {0}, dk = {0};
+        Impl::schedule_key(keys[k], ek, dk);
+        BOOST_CHECK(encryption_keys[k] == ek);
+        BOOST_CHECK(decryption_keys[k] == dk);
+        BOOST_CHECK(encryption_only_keys[k] == ek);
+    }
+
+    const std::size_t lengths[] = {1, 3, 8, 15, 16, 17, 31, 64, 67};
+    for (std::size_t n : lengths) {
+        std::vector<block_type> in(n), out(n), back(n);
+        for (std::size_t i = 0; i != n; ++i) {
+            for (std::size_t j = 0; j != in[i].size(); ++j) {
+                in[i][j] = static_cast<std::uint8_t>(i == 0 ? 0x11 * j : i * 37 + j);
+            }
+        }
+
+        Impl::encrypt_blocks(in.data(), out.data(), n, encryption_key);
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), out[0].begin()));
+        for (std::size_t i = 0; i != n; ++i) {
+            BOOST_CHECK(out[i] == Impl::encrypt_block(in[i], encryption_key));
+        }
+
+        Impl::decrypt_blocks(out.data(), back.data(), n, decryption_key);
+        BOOST_CHECK(back == in);
+    }
+}
+
+template<std::size_t KeyBits>
+void check_kernels(const std::array<std::uint8_t, 16> &expected) {
+    if (block::detail::rijndael_vaes_impl<KeyBits, 128, 512>::supported()) {
+        check_kernel<block::detail::rijndael_vaes_impl<KeyBits, 128, 512>, KeyBits>(expected);
+    } else {
+        BOOST_TEST_MESSAGE("VAES with AVX-512 is not available, skipping");
+    }
+
+    if (block::detail::rijndael_vaes_impl<KeyBits, 128, 256>::supported()) {
+        check_kernel<block::detail::rijndael_vaes_impl<KeyBits, 128, 256>, KeyBits>(expected);
+    } else {
+        BOOST_TEST_MESSAGE("VAES with AVX2 is not available, skipping");
+    }
+
+    if (cpuid::has_aes_ni() && cpuid::has_ssse3()) {
+        check_kernel<block::detail::rijndael_ni_impl<KeyBits, 128>, KeyBits>(expected);
+    }
+
+    if (cpuid::has_ssse3()) {
+        check_kernel<block::detail::rijndael_ssse3_impl<KeyBits, 128, block::detail::rijndael_policy<KeyBits, 128>>,
+                     KeyBits>(expected);
+    }
+
+    check_kernel<block::detail::rijndael_bitsliced_impl<KeyBits, 128>, KeyBits>(expected);
+    check_kernel<block::detail::rijndael_impl<KeyBits, 128>, KeyBits>(expected);
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_kernels) {
+    check_kernels<128>({0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5,
+                        0x5a});
+}
+
+BOOST_AUTO_TEST_CASE(aes_192_kernels) {
+    check_kernels<192>({0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0, 0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71,
+                        0x91});
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_kernels) {
+    check_kernels<256>({0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60,
+                        0x89});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
+
+BOOST_AUTO_TEST_SUITE(rijndael_constexpr_test_suite)
+
+// FIPS-197 appendix C, evaluated entirely at compile time by the portable implementation
+template<std::size_t... I>
+constexpr std::array<std::uint8_t, sizeof...(I)> counting_bytes(std::size_t step, std::index_sequence<I...>) {
+    return {{static_cast<std::uint8_t>(step * I)...}};
+}
+
+constexpr bool equal_bytes(const std::array<std::uint8_t, 16> &a, const std::array<std::uint8_t, 16> &b) {
+    for (std::size_t i = 0; i != a.size(); ++i) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<std::size_t KeyBits>
+constexpr std::array<std::uint8_t, 16> fips197_encrypt() {
+    typedef block::detail::rijndael_impl<KeyBits, 128> impl_type;
+
+    return impl_type::encrypt_block(counting_bytes(0x11, std::make_index_sequence<16>()),
+                                    impl_type::encryption_schedule(
+                                        counting_bytes(1, std::make_index_sequence<KeyBits / CHAR_BIT>())));
+}
+
+template<std::size_t KeyBits>
+constexpr bool fips197_round_trip() {
+    typedef block::detail::rijndael_impl<KeyBits, 128> impl_type;
+
+    return equal_bytes(
+        impl_type::decrypt_block(fips197_encrypt<KeyBits>(),
+                                 impl_type::decryption_schedule(impl_type::encryption_schedule(
+                                     counting_bytes(1, std::make_index_sequence<KeyBits / CHAR_BIT>())))),
+        counting_bytes(0x11, std::make_index_sequence<16>()));
+}
+
+static_assert(equal_bytes(fips197_encrypt<128>(), {{0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7,
+                                                    0x80, 0x70, 0xb4, 0xc5, 0x5a}}),
+              "AES-128 known answer");
+static_assert(equal_bytes(fips197_encrypt<192>(), {{0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0, 0x6e, 0xaf, 0x70,
+                                                    0xa0, 0xec, 0x0d, 0x71, 0x91}}),
+              "AES-192 known answer");
+static_assert(equal_bytes(fips197_encrypt<256>(), {{0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49,
+                                                    0x90, 0x4b, 0x49, 0x60, 0x89}}),
+              "AES-256 known answer");
+static_assert(fips197_round_trip<128>() && fips197_round_trip<192>() && fips197_round_trip<256>(),
+              "AES decryption inverts encryption");
+
+BOOST_AUTO_TEST_CASE(rijndael_256_256_constexpr_matches_runtime) {
+    typedef block::detail::rijndael_impl<256, 256> impl_type;
+
+    constexpr block::detail::rijndael_policy<256, 256>::key_schedule_type encryption_key =
+        impl_type::encryption_schedule(counting_bytes(1, std::make_index_sequence<32>()));
+    constexpr std::array<std::uint8_t, 32> plaintext = {};
+    constexpr std::array<std::uint8_t, 32> ciphertext = impl_type::encrypt_block(plaintext, encryption_key);
+
+    block::rijndael<256, 256> cipher(counting_bytes(1, std::make_index_sequence<32>()));
+    BOOST_CHECK(cipher.encrypt(plaintext) == ciphertext);
+    BOOST_CHECK(cipher.decrypt(ciphertext) == plaintext);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(rijndael_initializer_list_test_suite)
 
 BOOST_AUTO_TEST_CASE(rijndael_128_128_1) {
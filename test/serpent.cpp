@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE serpent_cipher_test
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/block/algorithm/encrypt.hpp>
+#include <nil/crypto3/block/algorithm/decrypt.hpp>
+
+#include <nil/crypto3/block/serpent.hpp>
+
+#include "batch_test.hpp"
+
+using namespace nil::crypto3;
+
+namespace {
+    std::vector<char> counting_bytes(std::size_t n) {
+        std::vector<char> result(n);
+        for (std::size_t i = 0; i != n; ++i) {
+            result[i] = static_cast<char>(i);
+        }
+        return result;
+    }
+
+    const std::vector<char> plaintext = {'\x00', '\x11', '\x22', '\x33', '\x44', '\x55', '\x66', '\x77',
+                                         '\x88', '\x99', '\xaa', '\xbb', '\xcc', '\xdd', '\xee', '\xff'};
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(serpent_test_suite)
+
+BOOST_AUTO_TEST_CASE(serpent_128) {
+    std::string out = encrypt<block::serpent<128>>(plaintext, counting_bytes(16));
+
+    BOOST_CHECK_EQUAL(out, "563e2cf8740a27c164804560391e9b27");
+
+    std::string zero = encrypt<block::serpent<128>>(std::vector<char>(16), std::vector<char>(16));
+
+    BOOST_CHECK_EQUAL(zero, "3620b17ae6a993d09618b8768266bae9");
+}
+
+BOOST_AUTO_TEST_CASE(serpent_192) {
+    std::string out = encrypt<block::serpent<192>>(plaintext, counting_bytes(24));
+
+    BOOST_CHECK_EQUAL(out, "6ab816c82de53b93005008afa2246a02");
+
+    std::string zero = encrypt<block::serpent<192>>(std::vector<char>(16), std::vector<char>(24));
+
+    BOOST_CHECK_EQUAL(zero, "a583ef976a292b406bbd5dc8256b0442");
+}
+
+BOOST_AUTO_TEST_CASE(serpent_256) {
+    std::string out = encrypt<block::serpent<256>>(plaintext, counting_bytes(32));
+
+    BOOST_CHECK_EQUAL(out, "2868b7a2d28ecd5e4fdefac3c4330074");
+
+    std::string zero = encrypt<block::serpent<256>>(std::vector<char>(16), std::vector<char>(32));
+
+    BOOST_CHECK_EQUAL(zero, "49672ba898d98df95019180445491089");
+}
+
+BOOST_AUTO_TEST_CASE(serpent_256_decrypt) {
+    std::string out = decrypt<block::serpent<256>>(
+        std::vector<char>({'\x28', '\x68', '\xb7', '\xa2', '\xd2', '\x8e', '\xcd', '\x5e', '\x4f', '\xde', '\xfa',
+                           '\xc3', '\xc4', '\x33', '\x00', '\x74'}),
+        counting_bytes(32));
+
+    BOOST_CHECK_EQUAL(out, "00112233445566778899aabbccddeeff");
+}
+
+// Every length from a single block up to two full AVX2 batches and a tail
+BOOST_AUTO_TEST_CASE(serpent_batches_match_single_blocks) {
+    check_batches<block::serpent<128>>(19);
+    check_batches<block::serpent<256>>(19);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE sm4_cipher_test
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/block/algorithm/encrypt.hpp>
+#include <nil/crypto3/block/algorithm/decrypt.hpp>
+
+#include <nil/crypto3/block/sm4.hpp>
+
+using namespace nil::crypto3;
+
+BOOST_AUTO_TEST_SUITE(sm4_test_suite)
+
+// GB/T 32907-2016, appendix A
+BOOST_AUTO_TEST_CASE(sm4_1) {
+    std::vector<char> input = {'\x01', '\x23', '\x45', '\x67', '\x89', '\xab', '\xcd', '\xef',
+                               '\xfe', '\xdc', '\xba', '\x98', '\x76', '\x54', '\x32', '\x10'};
+    std::vector<char> key = input;
+
+    std::string out = encrypt<block::sm4>(input, key);
+
+    BOOST_CHECK_EQUAL(out, "681edf34d206965e86b3e94f536e4246");
+}
+
+BOOST_AUTO_TEST_CASE(sm4_2) {
+    std::vector<char> input = {'\x6b', '\xc1', '\xbe', '\xe2', '\x2e', '\x40', '\x9f', '\x96',
+                               '\xe9', '\x3d', '\x7e', '\x11', '\x73', '\x93', '\x17', '\x2a'};
+    std::vector<char> key = {'\x2b', '\x7e', '\x15', '\x16', '\x28', '\xae', '\xd2', '\xa6',
+                             '\xab', '\xf7', '\x15', '\x88', '\x09', '\xcf', '\x4f', '\x3c'};
+
+    std::string out = encrypt<block::sm4>(input, key);
+
+    BOOST_CHECK_EQUAL(out, "a51411ff04a711443891fce7ab842a29");
+
+    std::vector<char> ciphertext = {'\xa5', '\x14', '\x11', '\xff', '\x04', '\xa7', '\x11', '\x44',
+                                    '\x38', '\x91', '\xfc', '\xe7', '\xab', '\x84', '\x2a', '\x29'};
+
+    std::string back = decrypt<block::sm4>(ciphertext, key);
+
+    BOOST_CHECK_EQUAL(back, "6bc1bee22e409f96e93d7e117393172a");
+}
+
+// Whatever path the batch takes has to agree with the portable constant-time rounds
+BOOST_AUTO_TEST_CASE(sm4_batches_match_portable_rounds) {
+    typedef block::detail::sm4_functions functions_type;
+
+    const block::sm4::key_type key = {0x01234567, 0x89abcdef, 0xfedcba98, 0x76543210};
+    const block::sm4 cipher(key);
+
+    functions_type::key_schedule_type encryption_key, decryption_key;
+    functions_type::schedule_key(key, encryption_key, decryption_key);
+
+    std::vector<block::sm4::block_type> in(37), out(in.size()), back(in.size());
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        in[i] = {{static_cast<block::sm4::word_type>(i * 0x9e3779b9), 0xdeadbeef, 0x8badf00d,
+                  static_cast<block::sm4::word_type>(i)}};
+    }
+
+    for (std::size_t n = 1; n <= in.size(); ++n) {
+        cipher.encrypt_n(in.data(), out.data(), n);
+        cipher.decrypt_n(out.data(), back.data(), n);
+        for (std::size_t i = 0; i != n; ++i) {
+            BOOST_CHECK(out[i] == functions_type::crypt_block(in[i], encryption_key));
+            BOOST_CHECK(back[i] == in[i]);
+        }
+    }
+}
+
+#if defined(CRYPTO3_HAS_SM4_AES_NI)
+// crypt_blocks leaves AES-NI only the tails where VAES is present
+BOOST_AUTO_TEST_CASE(sm4_aes_ni_kernel) {
+    typedef block::detail::sm4_functions functions_type;
+
+    if (!cpuid::has_aes_ni() || !cpuid::has_ssse3()) {
+        return;
+    }
+
+    const block::sm4::key_type key = {0x2b7e1516, 0x28aed2a6, 0xabf71588, 0x09cf4f3c};
+
+    functions_type::key_schedule_type encryption_key, decryption_key;
+    functions_type::schedule_key(key, encryption_key, decryption_key);
+
+    std::vector<block::sm4::block_type> in(21), out(in.size());
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        in[i] = {{0x6bc1bee2, 0x2e409f96, 0xe93d7e11, static_cast<block::sm4::word_type>(i)}};
+    }
+
+    functions_type::crypt_blocks_aes_ni(in.data(), out.data(), in.size(), encryption_key);
+    for (std::size_t i = 0; i != in.size(); ++i) {
+        BOOST_CHECK(out[i] == functions_type::crypt_block(in[i], encryption_key));
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()